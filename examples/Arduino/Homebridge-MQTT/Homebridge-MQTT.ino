@@ -224,11 +224,14 @@ void loop() {
     }
 
     // Publishes status per partition
-    for (byte partition = 0; partition < dscPartitions; partition++) {
+    while (dsc.partitionsChanged) {
+      byte partition = dscLowestBit(dsc.partitionsChanged);  // Finds the next partition with a status change
+      dsc.partitionsChanged &= ~(1 << partition);
+      byte partitionChanged = dsc.partitionChanged[partition];
+      dsc.partitionChanged[partition] = 0;                     // Resets the partition status flags
 
       // Publishes armed/disarmed status
-      if (dsc.armedChanged[partition]) {
-        dsc.armedChanged[partition] = false;  // Resets the partition armed status flag
+      if (partitionChanged & dscArmedChanged) {
 
         // Appends the mqttPartitionTopic with the partition number
         char publishTopic[strlen(mqttPartitionTopic) + 1];
@@ -237,19 +240,18 @@ void loop() {
         itoa(partition + 1, partitionNumber, 10);
         strcat(publishTopic, partitionNumber);
 
-        if (dsc.armed[partition]) {
-          if (dsc.armedAway[partition] && dsc.noEntryDelay[partition]) mqtt.publish(publishTopic, "NA", true);       // Night armed
-          else if (dsc.armedAway[partition]) mqtt.publish(publishTopic, "AA", true);                                      // Away armed
-          else if (dsc.armedStay[partition] && dsc.noEntryDelay[partition]) mqtt.publish(publishTopic, "NA", true);  // Night armed
-          else if (dsc.armedStay[partition]) mqtt.publish(publishTopic, "SA", true);                                      // Stay armed
+        if (dsc.partitions[partition].armed) {
+          if (dsc.partitions[partition].armedAway && dsc.partitions[partition].noEntryDelay) mqtt.publish(publishTopic, "NA", true);       // Night armed
+          else if (dsc.partitions[partition].armedAway) mqtt.publish(publishTopic, "AA", true);                                      // Away armed
+          else if (dsc.partitions[partition].armedStay && dsc.partitions[partition].noEntryDelay) mqtt.publish(publishTopic, "NA", true);  // Night armed
+          else if (dsc.partitions[partition].armedStay) mqtt.publish(publishTopic, "SA", true);                                      // Stay armed
         }
         else mqtt.publish(publishTopic, "D", true);  // Disarmed
       }
 
       // Publishes alarm triggered status
-      if (dsc.alarmChanged[partition]) {
-        dsc.alarmChanged[partition] = false;  // Resets the partition alarm status flag
-        if (dsc.alarm[partition]) {
+      if (partitionChanged & dscAlarmChanged) {
+        if (dsc.partitions[partition].alarm) {
 
           // Appends the mqttPartitionTopic with the partition number
           char publishTopic[strlen(mqttPartitionTopic) + 1];
@@ -263,7 +265,7 @@ void loop() {
       }
 
       // Publishes status when the system is disarmed during exit delay
-      if (dsc.exitDelayChanged[partition] && !dsc.exitDelay[partition] && !dsc.armed[partition]) {
+      if ((partitionChanged & dscExitDelayChanged) && !dsc.partitions[partition].exitDelay && !dsc.partitions[partition].armed) {
 
           // Appends the mqttPartitionTopic with the partition number
           char publishTopic[strlen(mqttPartitionTopic) + 1];
@@ -276,8 +278,7 @@ void loop() {
       }
 
       // Publishes fire alarm status
-      if (dsc.fireChanged[partition]) {
-        dsc.fireChanged[partition] = false;  // Resets the fire status flag
+      if (partitionChanged & dscFireChanged) {
 
         // Appends the mqttFireTopic with the partition number
         char firePublishTopic[strlen(mqttFireTopic) + 1];
@@ -286,37 +287,30 @@ void loop() {
         itoa(partition + 1, partitionNumber, 10);
         strcat(firePublishTopic, partitionNumber);
 
-        if (dsc.fire[partition]) mqtt.publish(firePublishTopic, "1");  // Fire alarm tripped
+        if (dsc.partitions[partition].fire) mqtt.publish(firePublishTopic, "1");  // Fire alarm tripped
         else mqtt.publish(firePublishTopic, "0");                           // Fire alarm restored
       }
     }
 
     // Publishes zones 1-64 status in a separate topic per zone
-    // Zone status is stored in the openZones[] and openZonesChanged[] arrays using 1 bit per zone, up to 64 zones:
-    //   openZones[0] and openZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   openZones[1] and openZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   openZones[7] and openZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone status is stored in openZones and openZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.openZonesStatusChanged) {
       dsc.openZonesStatusChanged = false;                           // Resets the open zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.openZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual open zone status flag
-            bitWrite(dsc.openZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual open zone status flag
-
-            // Appends the mqttZoneTopic with the zone number
-            char zonePublishTopic[strlen(mqttZoneTopic) + 2];
-            char zone[3];
-            strcpy(zonePublishTopic, mqttZoneTopic);
-            itoa(zoneBit + 1 + (zoneGroup * 8), zone, 10);
-            strcat(zonePublishTopic, zone);
-
-            if (bitRead(dsc.openZones[zoneGroup], zoneBit)) {
-              mqtt.publish(zonePublishTopic, "1", true);            // Zone open
-            }
-            else mqtt.publish(zonePublishTopic, "0", true);         // Zone closed
-          }
+      while (dsc.openZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.openZonesChanged);         // Gets and resets the next changed open zone: 0 = Zone 1 ... 63 = Zone 64
+
+        // Appends the mqttZoneTopic with the zone number
+        char zonePublishTopic[strlen(mqttZoneTopic) + 2];
+        char zone[3];
+        strcpy(zonePublishTopic, mqttZoneTopic);
+        itoa(zoneIndex + 1, zone, 10);
+        strcat(zonePublishTopic, zone);
+
+        if (dsc.openZones & dscZoneBit(zoneIndex)) {
+          mqtt.publish(zonePublishTopic, "1", true);                // Zone open
         }
+        else mqtt.publish(zonePublishTopic, "0", true);             // Zone closed
       }
     }
 
@@ -341,28 +335,28 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
   }
 
   // homebridge-mqttthing STAY_ARM
-  if (payload[payloadIndex] == 'S' && !dsc.armed[partition] && !dsc.exitDelay[partition]) {
+  if (payload[payloadIndex] == 'S' && !dsc.partitions[partition].armed && !dsc.partitions[partition].exitDelay) {
     while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
     dsc.writePartition = partition + 1;    // Sets writes to the partition number
     dsc.write('s');  // Keypad stay arm
   }
 
   // homebridge-mqttthing AWAY_ARM
-  else if (payload[payloadIndex] == 'A' && !dsc.armed[partition] && !dsc.exitDelay[partition]) {
+  else if (payload[payloadIndex] == 'A' && !dsc.partitions[partition].armed && !dsc.partitions[partition].exitDelay) {
     while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
     dsc.writePartition = partition + 1;    // Sets writes to the partition number
     dsc.write('w');  // Keypad away arm
   }
 
   // homebridge-mqttthing NIGHT_ARM
-  else if (payload[payloadIndex] == 'N' && !dsc.armed[partition] && !dsc.exitDelay[partition]) {
+  else if (payload[payloadIndex] == 'N' && !dsc.partitions[partition].armed && !dsc.partitions[partition].exitDelay) {
     while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
     dsc.writePartition = partition + 1;    // Sets writes to the partition number
     dsc.write('n');  // Keypad arm with no entry delay
   }
 
   // homebridge-mqttthing DISARM
-  else if (payload[payloadIndex] == 'D' && (dsc.armed[partition] || dsc.exitDelay[partition])) {
+  else if (payload[payloadIndex] == 'D' && (dsc.partitions[partition].armed || dsc.partitions[partition].exitDelay)) {
     while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
     dsc.writePartition = partition + 1;    // Sets writes to the partition number
     dsc.write(accessCode);
@@ -43,11 +43,17 @@
 #define dscWritePin 6  // Arduino Uno: 2-12
 dscKeybusInterface dsc(dscClockPin, dscReadPin, dscWritePin);
 
+// Writes Keybus data as compact binary capture frames instead of printing decoded messages, to log the Keybus at
+// full speed on a computer - see printPanelCapture() in src/dscKeybusPrintData.cpp for the frame format.
+//#define captureOutput
+
 
 void setup() {
   Serial.begin(115200);
+  #if !defined(captureOutput)
   Serial.println();
   Serial.println();
+  #endif
 
   // Optional configuration
   dsc.hideKeypadDigits = false;      // Controls if keypad digits are hidden for publicly posted logs (default: false)
@@ -59,7 +65,9 @@ void setup() {
   // begin() sets Serial by default and can accept a different stream: begin(Serial1), etc.
   dsc.begin();
 
+  #if !defined(captureOutput)
   Serial.println(F("DSC Keybus Interface is online."));
+  #endif
 }
 
 
@@ -70,6 +78,17 @@ void loop() {
       dsc.write(Serial.read());
   }
 
+  // Writes panel, keypad, and module data as binary capture frames
+  #if defined(captureOutput)
+  if (dsc.handlePanel()) {
+    if (dsc.bufferOverflow) dsc.printOverflowCapture();  // Marks dropped commands in the capture
+    dsc.bufferOverflow = false;
+    dsc.printPanelCapture();
+  }
+  if (dsc.handleModule()) dsc.printModuleCapture();
+  return;
+  #endif
+
   if (dsc.handlePanel()) {
 
     // If the Keybus data buffer is exceeded, the sketch is too busy to process all Keybus commands.  Call
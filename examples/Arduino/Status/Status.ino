@@ -80,16 +80,19 @@ void loop() {
     dsc.bufferOverflow = false;
 
     // Checks status per partition
-    for (byte partition = 0; partition < dscPartitions; partition++) {
-
-      if (dsc.armedChanged[partition]) {
-        dsc.armedChanged[partition] = false;  // Resets the partition armed status flag
-        if (dsc.armed[partition]) {
+    while (dsc.partitionsChanged) {
+      byte partition = dscLowestBit(dsc.partitionsChanged);  // Finds the next partition with a status change
+      dsc.partitionsChanged &= ~(1 << partition);
+      byte partitionChanged = dsc.partitionChanged[partition];
+      dsc.partitionChanged[partition] = 0;                     // Resets the partition status flags
+
+      if (partitionChanged & dscArmedChanged) {
+        if (dsc.partitions[partition].armed) {
           Serial.print(F("Partition "));
           Serial.print(partition + 1);
           Serial.print(F(" armed"));
-          if (dsc.armedAway[partition]) Serial.println(F(" away"));
-          if (dsc.armedStay[partition]) Serial.println(F(" stay"));
+          if (dsc.partitions[partition].armedAway) Serial.println(F(" away"));
+          if (dsc.partitions[partition].armedStay) Serial.println(F(" stay"));
         }
         else {
           Serial.print(F("Partition "));
@@ -98,36 +101,32 @@ void loop() {
         }
       }
 
-      if (dsc.alarmChanged[partition]) {
-        dsc.alarmChanged[partition] = false;  // Resets the partition alarm status flag
-        if (dsc.alarm[partition]) {
+      if (partitionChanged & dscAlarmChanged) {
+        if (dsc.partitions[partition].alarm) {
           Serial.print(F("Partition "));
           Serial.print(partition + 1);
           Serial.println(F(" in alarm"));
         }
       }
 
-      if (dsc.exitDelayChanged[partition]) {
-        dsc.exitDelayChanged[partition] = false;  // Resets the exit delay status flag
-        if (dsc.exitDelay[partition]) {
+      if (partitionChanged & dscExitDelayChanged) {
+        if (dsc.partitions[partition].exitDelay) {
           Serial.print(F("Partition "));
           Serial.print(partition + 1);
           Serial.println(F(" exit delay in progress"));
         }
       }
 
-      if (dsc.entryDelayChanged[partition]) {
-        dsc.entryDelayChanged[partition] = false;  // Resets the exit delay status flag
-        if (dsc.entryDelay[partition]) {
+      if (partitionChanged & dscEntryDelayChanged) {
+        if (dsc.partitions[partition].entryDelay) {
           Serial.print(F("Partition "));
           Serial.print(partition + 1);
           Serial.println(F(" entry delay in progress"));
         }
       }
 
-      if (dsc.fireChanged[partition]) {
-        dsc.fireChanged[partition] = false;  // Resets the fire status flag
-        if (dsc.fire[partition]) {
+      if (partitionChanged & dscFireChanged) {
+        if (dsc.partitions[partition].fire) {
           Serial.print(F("Partition "));
           Serial.print(partition + 1);
           Serial.println(F(" fire alarm on"));
@@ -140,50 +139,36 @@ void loop() {
       }
     }
 
-    // Zone status is stored in the openZones[] and openZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   openZones[0] and openZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   openZones[1] and openZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   openZones[7] and openZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone status is stored in openZones and openZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.openZonesStatusChanged) {
       dsc.openZonesStatusChanged = false;                           // Resets the open zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.openZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual open zone status flag
-            bitWrite(dsc.openZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual open zone status flag
-            if (bitRead(dsc.openZones[zoneGroup], zoneBit)) {       // Zone open
-              Serial.print(F("Zone open: "));
-              Serial.println(zoneBit + 1 + (zoneGroup * 8));        // Determines the zone number
-            }
-            else {                                                  // Zone closed
-              Serial.print(F("Zone restored: "));
-              Serial.println(zoneBit + 1 + (zoneGroup * 8));        // Determines the zone number
-            }
-          }
+      while (dsc.openZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.openZonesChanged);         // Gets and resets the next changed open zone: 0 = Zone 1 ... 63 = Zone 64
+        if (dsc.openZones & dscZoneBit(zoneIndex)) {                // Zone open
+          Serial.print(F("Zone open: "));
+          Serial.println(zoneIndex + 1);                            // Determines the zone number
+        }
+        else {                                                      // Zone closed
+          Serial.print(F("Zone restored: "));
+          Serial.println(zoneIndex + 1);                            // Determines the zone number
         }
       }
     }
 
-    // Zone alarm status is stored in the alarmZones[] and alarmZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone alarm status is stored in alarmZones and alarmZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.alarmZonesStatusChanged) {
       dsc.alarmZonesStatusChanged = false;                           // Resets the alarm zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.alarmZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual alarm zone status flag
-            bitWrite(dsc.alarmZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual alarm zone status flag
-            if (bitRead(dsc.alarmZones[zoneGroup], zoneBit)) {       // Zone alarm
-              Serial.print(F("Zone alarm: "));
-              Serial.println(zoneBit + 1 + (zoneGroup * 8));         // Determines the zone number
-            }
-            else {
-              Serial.print(F("Zone alarm restored: "));
-              Serial.println(zoneBit + 1 + (zoneGroup * 8));         // Determines the zone number
-            }
-          }
+      while (dsc.alarmZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.alarmZonesChanged);         // Gets and resets the next changed alarm zone: 0 = Zone 1 ... 63 = Zone 64
+        if (dsc.alarmZones & dscZoneBit(zoneIndex)) {                // Zone alarm
+          Serial.print(F("Zone alarm: "));
+          Serial.println(zoneIndex + 1);                             // Determines the zone number
+        }
+        else {
+          Serial.print(F("Zone alarm restored: "));
+          Serial.println(zoneIndex + 1);                             // Determines the zone number
         }
       }
     }
@@ -114,29 +114,31 @@ void loop() {
     }
 
     // Checks status per partition
-    for (byte partition = 0; partition < dscPartitions; partition++) {
+    while (dsc.partitionsChanged) {
+      byte partition = dscLowestBit(dsc.partitionsChanged);  // Finds the next partition with a status change
+      dsc.partitionsChanged &= ~(1 << partition);
+      byte partitionChanged = dsc.partitionChanged[partition];
+      dsc.partitionChanged[partition] = 0;                     // Resets the partition status flags
 
-      if (dsc.alarmChanged[partition]) {
-        dsc.alarmChanged[partition] = false;  // Resets the partition alarm status flag
+      if (partitionChanged & dscAlarmChanged) {
 
         char emailBody[12] = "Partition ";
         char partitionNumber[2];
         itoa(partition + 1, partitionNumber, 10);
         strcat(emailBody, partitionNumber);
 
-        if (dsc.alarm[partition]) sendEmail("Security system in alarm", emailBody);
+        if (dsc.partitions[partition].alarm) sendEmail("Security system in alarm", emailBody);
         else sendEmail("Security system disarmed after alarm", emailBody);
       }
 
-      if (dsc.fireChanged[partition]) {
-        dsc.fireChanged[partition] = false;  // Resets the fire status flag
+      if (partitionChanged & dscFireChanged) {
 
         char emailBody[12] = "Partition ";
         char partitionNumber[2];
         itoa(partition + 1, partitionNumber, 10);
         strcat(emailBody, partitionNumber);
 
-        if (dsc.fire[partition]) sendEmail("Security system fire alarm", emailBody);
+        if (dsc.partitions[partition].fire) sendEmail("Security system fire alarm", emailBody);
         else sendEmail("Security system fire alarm restored", emailBody);
       }
     }
@@ -107,71 +107,57 @@ void loop() {
     }
 
     // Publish armed status
-    if (dsc.armedChanged[0]) {
-      dsc.armedChanged[0] = false;  // Resets the partition armed status flag
-      if (dsc.armed[0]) {
-        if (dsc.armedAway[0]) Homey.setCapabilityValue("homealarm_state", "armed", true);
-        if (dsc.armedStay[0]) Homey.setCapabilityValue("homealarm_state", "partially_armed", true);
+    if (dsc.partitionChanged[0] & dscArmedChanged) {
+      dsc.partitionChanged[0] &= ~dscArmedChanged;  // Resets the armed status flag
+      if (dsc.partitions[0].armed) {
+        if (dsc.partitions[0].armedAway) Homey.setCapabilityValue("homealarm_state", "armed", true);
+        if (dsc.partitions[0].armedStay) Homey.setCapabilityValue("homealarm_state", "partially_armed", true);
       }
       else Homey.setCapabilityValue("homealarm_state", "disarmed", true);
     }
 
     // Publish alarm status
-    if (dsc.alarmChanged[0]) {
-      dsc.alarmChanged[0] = false;  // Resets the partition alarm status flag
-      if (dsc.alarm[0]) Homey.setCapabilityValue("alarm_tamper", true);
+    if (dsc.partitionChanged[0] & dscAlarmChanged) {
+      dsc.partitionChanged[0] &= ~dscAlarmChanged;  // Resets the alarm status flag
+      if (dsc.partitions[0].alarm) Homey.setCapabilityValue("alarm_tamper", true);
       else Homey.setCapabilityValue("alarm_tamper", false);
     }
 
     // Publish fire alarm status
-    if (dsc.fireChanged[0]) {
-      dsc.fireChanged[0] = false;  // Resets the fire status flag
-      if (dsc.fire[0]) Homey.setCapabilityValue("alarm_fire", true);
+    if (dsc.partitionChanged[0] & dscFireChanged) {
+      dsc.partitionChanged[0] &= ~dscFireChanged;  // Resets the fire status flag
+      if (dsc.partitions[0].fire) Homey.setCapabilityValue("alarm_fire", true);
       else Homey.setCapabilityValue("alarm_fire", false);
     }
 
     // Publish zones 1-64 status
-    // Zone status is stored in the openZones[] and openZonesChanged[] arrays using 1 bit per zone, up to 64 zones:
-    //   openZones[0] and openZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   openZones[1] and openZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   openZones[7] and openZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone status is stored in openZones and openZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.openZonesStatusChanged) {
       dsc.openZonesStatusChanged = false;                           // Resets the open zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.openZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual open zone status flag
-            bitWrite(dsc.openZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual open zone status flag
-            if (bitRead(dsc.openZones[zoneGroup], zoneBit)) {
-              Homey.trigger("ZoneOpen", (zoneBit + 1 + (zoneGroup * 8)));
-            }
-            else {
-              Homey.trigger("ZoneRestored", (zoneBit + 1 + (zoneGroup * 8)));
-            }
-          }
+      while (dsc.openZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.openZonesChanged);         // Gets and resets the next changed open zone: 0 = Zone 1 ... 63 = Zone 64
+        if (dsc.openZones & dscZoneBit(zoneIndex)) {
+          Homey.trigger("ZoneOpen", (zoneIndex + 1));
+        }
+        else {
+          Homey.trigger("ZoneRestored", (zoneIndex + 1));
         }
       }
     }
 
     // Publish alarm zones 1-64
-    // Zone alarm status is stored in the alarmZones[] and alarmZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone alarm status is stored in alarmZones and alarmZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.alarmZonesStatusChanged) {
       dsc.alarmZonesStatusChanged = false;                           // Resets the alarm zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.alarmZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual alarm zone status flag
-            bitWrite(dsc.alarmZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual alarm zone status flag
-            if (bitRead(dsc.alarmZones[zoneGroup], zoneBit)) {
-              Homey.trigger("AlarmZoneOpen", (zoneBit + 1 + (zoneGroup * 8)));
-            }
-            else {
-              Homey.trigger("AlarmZoneRestored", (zoneBit + 1 + (zoneGroup * 8)));
-            }
-          }
+      while (dsc.alarmZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.alarmZonesChanged);         // Gets and resets the next changed alarm zone: 0 = Zone 1 ... 63 = Zone 64
+        if (dsc.alarmZones & dscZoneBit(zoneIndex)) {
+          Homey.trigger("AlarmZoneOpen", (zoneIndex + 1));
+        }
+        else {
+          Homey.trigger("AlarmZoneRestored", (zoneIndex + 1));
         }
       }
     }
@@ -183,7 +169,7 @@ void loop() {
 
 // Arm stay
 void armStay() {
-   if (Homey.value.toInt() == 1 && !dsc.armed[0] && !dsc.exitDelay[0]) {  // Read the argument sent from the homey flow
+   if (Homey.value.toInt() == 1 && !dsc.partitions[0].armed && !dsc.partitions[0].exitDelay) {  // Read the argument sent from the homey flow
      while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
      dsc.write('s');  // Keypad stay arm
 
@@ -193,7 +179,7 @@ void armStay() {
 
 // Arm away
 void armAway() {
-   if (Homey.value.toInt() == 1 && !dsc.armed[0] && !dsc.exitDelay[0]) {  // Read the argument sent from the homey flow
+   if (Homey.value.toInt() == 1 && !dsc.partitions[0].armed && !dsc.partitions[0].exitDelay) {  // Read the argument sent from the homey flow
      while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
      dsc.write('w');  // Keypad away arm
   }
@@ -202,7 +188,7 @@ void armAway() {
 
 // Disarm
 void disarm() {
-   if (Homey.value.toInt() == 1 && (dsc.armed[0] || dsc.exitDelay[0])) {
+   if (Homey.value.toInt() == 1 && (dsc.partitions[0].armed || dsc.partitions[0].exitDelay)) {
     while (!dsc.writeReady) dsc.handlePanel();  // Continues processing Keybus data until ready to write
     dsc.write(accessCode);
   }
@@ -45,11 +45,26 @@
 #define dscWritePin D8  // esp8266: D1, D2, D8 (GPIO 5, 4, 15)
 dscKeybusInterface dsc(dscClockPin, dscReadPin, dscWritePin);
 
+// Writes Keybus data as compact binary capture frames instead of printing decoded messages, to log the Keybus at
+// full speed on a computer - see printPanelCapture() in src/dscKeybusPrintData.cpp for the frame format.
+//#define captureOutput
+
+// Buffers output in memory and writes it to Serial from loop() at up to 11520 bytes per second (115200 baud), so that
+// printing does not wait for Serial and delay reading the Keybus.  If the Keybus sends data faster than Serial can
+// print, whole lines are dropped and counted in output.droppedLines.  Capture output writes directly to Serial and
+// does not use the buffer.
+#if !defined(captureOutput)
+byte outputBuffer[4096];
+dscBufferedStream output(Serial, outputBuffer, sizeof(outputBuffer), 11520);
+#endif
+
 
 void setup() {
   Serial.begin(115200);
+  #if !defined(captureOutput)
   Serial.println();
   Serial.println();
+  #endif
 
   // Optional configuration
   dsc.hideKeypadDigits = false;      // Controls if keypad digits are hidden for publicly posted logs (default: false)
@@ -59,9 +74,13 @@ void setup() {
 
   // Starts the Keybus interface and optionally specifies how to print data.
   // begin() sets Serial by default and can accept a different stream: begin(Serial1), etc.
-  dsc.begin();
+  #if defined(captureOutput)
+  dsc.begin();  // Binary frames are written directly, dscBufferedStream drops incomplete lines
+  #else
+  dsc.begin(output);
 
   Serial.println(F("DSC Keybus Interface is online."));
+  #endif
 }
 
 
@@ -72,54 +91,76 @@ void loop() {
       dsc.write(Serial.read());
   }
 
+  // Writes panel, keypad, and module data as binary capture frames
+  #if defined(captureOutput)
+  if (dsc.handlePanel()) {
+    if (dsc.bufferOverflow) dsc.printOverflowCapture();  // Marks dropped commands in the capture
+    dsc.bufferOverflow = false;
+    dsc.printPanelCapture();
+  }
+  if (dsc.handleModule()) dsc.printModuleCapture();
+
+  #else
   if (dsc.handlePanel()) {
 
     // If the Keybus data buffer is exceeded, the sketch is too busy to process all Keybus commands.  Call
     // handlePanel() more often, or increase dscBufferSize in the library: src/dscKeybusInterface.h
-    if (dsc.bufferOverflow) Serial.println(F("Keybus buffer overflow"));
+    if (dsc.bufferOverflow) output.println(F("Keybus buffer overflow"));
     dsc.bufferOverflow = false;
 
     // Prints panel data
     printTimestamp();
-    Serial.print(" ");
+    output.print(" ");
     dsc.printPanelBinary();   // Optionally prints without spaces: printPanelBinary(false);
-    Serial.print(" [");
+    output.print(" [");
     dsc.printPanelCommand();  // Prints the panel command as hex
-    Serial.print("] ");
+    output.print("] ");
     dsc.printPanelMessage();  // Prints the decoded message
-    Serial.println();
+    output.println();
 
     // Prints keypad and module data when valid panel data is printed
     if (dsc.handleModule()) {
       printTimestamp();
-      Serial.print(" ");
+      output.print(" ");
       dsc.printModuleBinary();   // Optionally prints without spaces: printKeybusBinary(false);
-      Serial.print(" ");
+      output.print(" ");
       dsc.printModuleMessage();  // Prints the decoded message
-      Serial.println();
+      output.println();
     }
   }
 
   // Prints keypad and module data when valid panel data is not available
   else if (dsc.handleModule()) {
     printTimestamp();
-    Serial.print(" ");
+    output.print(" ");
     dsc.printModuleBinary();  // Optionally prints without spaces: printKeybusBinary(false);
-    Serial.print(" ");
+    output.print(" ");
     dsc.printModuleMessage();
-    Serial.println();
+    output.println();
+  }
+
+  // Writes buffered output to Serial
+  output.update();
+  if (output.droppedLines > 0) {
+    output.print(output.droppedLines);
+    output.println(F(" lines of output dropped"));
+    output.droppedLines = 0;
+    output.droppedBytes = 0;
   }
+  #endif
 }
 
 // Prints a timestamp in seconds (with 2 decimal precision) - this is useful to determine when
 // the panel sends a group of messages immediately after each other due to an event.
+#if !defined(captureOutput)
 void printTimestamp() {
   float timeStamp = millis() / 1000.0;
-  if (timeStamp < 10) Serial.print("    ");
-  else if (timeStamp < 100) Serial.print("   ");
-  else if (timeStamp < 1000) Serial.print("  ");
-  else if (timeStamp < 10000) Serial.print(" ");
-  Serial.print(timeStamp, 2);
-  Serial.print(F(":"));
+  if (timeStamp < 10) output.print("    ");
+  else if (timeStamp < 100) output.print("   ");
+  else if (timeStamp < 1000) output.print("  ");
+  else if (timeStamp < 10000) output.print(" ");
+  output.print(timeStamp, 2);
+  output.print(F(":"));
 }
+#endif
 
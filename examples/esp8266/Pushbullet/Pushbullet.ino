@@ -100,19 +100,22 @@ void loop() {
     }
 
     // Checks status per partition
-    for (byte partition = 0; partition < dscPartitions; partition++) {
+    while (dsc.partitionsChanged) {
+      byte partition = dscLowestBit(dsc.partitionsChanged);  // Finds the next partition with a status change
+      dsc.partitionsChanged &= ~(1 << partition);
+      byte partitionChanged = dsc.partitionChanged[partition];
+      dsc.partitionChanged[partition] = 0;                     // Resets the partition status flags
 
       // Checks armed status
-      if (dsc.armedChanged[partition]) {
-        dsc.armedChanged[partition] = false;  // Resets the partition armed status flag
-        if (dsc.armed[partition]) {
+      if (partitionChanged & dscArmedChanged) {
+        if (dsc.partitions[partition].armed) {
 
           char pushMessage[40] = "Security system ";
-          if (dsc.armedAway[partition]) {
+          if (dsc.partitions[partition].armedAway) {
             char armedState[24] = "armed away: partition ";
             strcat(pushMessage, armedState);
           }
-          else if (dsc.armedStay[partition]) {
+          else if (dsc.partitions[partition].armedStay) {
             char armedState[24] = "armed stay: partition ";
             strcat(pushMessage, armedState);
           }
@@ -132,59 +135,50 @@ void loop() {
       }
 
       // Checks alarm triggered status
-      if (dsc.alarmChanged[partition]) {
-        dsc.alarmChanged[partition] = false;  // Resets the partition alarm status flag
+      if (partitionChanged & dscAlarmChanged) {
 
         char pushMessage[38] = "Security system in alarm: partition ";
         char partitionNumber[2];
         itoa(partition + 1, partitionNumber, 10);
         strcat(pushMessage, partitionNumber);
 
-        if (dsc.alarm[partition]) sendPush(pushMessage);
+        if (dsc.partitions[partition].alarm) sendPush(pushMessage);
         else sendPush("Security system disarmed after alarm");
       }
 
       // Checks fire alarm status
-      if (dsc.fireChanged[partition]) {
-        dsc.fireChanged[partition] = false;  // Resets the fire status flag
+      if (partitionChanged & dscFireChanged) {
 
         char pushMessage[40] = "Security system fire alarm: partition ";
         char partitionNumber[2];
         itoa(partition + 1, partitionNumber, 10);
         strcat(pushMessage, partitionNumber);
 
-        if (dsc.fire[partition]) sendPush(pushMessage);
+        if (dsc.partitions[partition].fire) sendPush(pushMessage);
         else sendPush("Security system fire alarm restored");
       }
     }
 
     // Checks for zones in alarm
-    // Zone alarm status is stored in the alarmZones[] and alarmZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone alarm status is stored in alarmZones and alarmZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.alarmZonesStatusChanged) {
       dsc.alarmZonesStatusChanged = false;                           // Resets the alarm zones status flag
-      for (byte zoneGroup = 0; zoneGroup < dscZones; zoneGroup++) {
-        for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-          if (bitRead(dsc.alarmZonesChanged[zoneGroup], zoneBit)) {  // Checks an individual alarm zone status flag
-            bitWrite(dsc.alarmZonesChanged[zoneGroup], zoneBit, 0);  // Resets the individual alarm zone status flag
-            if (bitRead(dsc.alarmZones[zoneGroup], zoneBit)) {       // Zone alarm
-              char pushMessage[24] = "Security zone alarm: ";
-              char zoneNumber[3];
-              itoa((zoneBit + 1 + (zoneGroup * 8)), zoneNumber, 10); // Determines the zone number
-              strcat(pushMessage, zoneNumber);
-              sendPush(pushMessage);
-            }
-            else {
-              char pushMessage[33] = "Security zone alarm restored: ";
-              char zoneNumber[3];
-              itoa((zoneBit + 1 + (zoneGroup * 8)), zoneNumber, 10); // Determines the zone number
-              strcat(pushMessage, zoneNumber);
-              sendPush(pushMessage);
-            }
-          }
+      while (dsc.alarmZonesChanged) {
+        byte zoneIndex = dscNextZone(dsc.alarmZonesChanged);         // Gets and resets the next changed alarm zone: 0 = Zone 1 ... 63 = Zone 64
+        if (dsc.alarmZones & dscZoneBit(zoneIndex)) {                // Zone alarm
+          char pushMessage[24] = "Security zone alarm: ";
+          char zoneNumber[3];
+          itoa((zoneIndex + 1), zoneNumber, 10);                     // Determines the zone number
+          strcat(pushMessage, zoneNumber);
+          sendPush(pushMessage);
+        }
+        else {
+          char pushMessage[33] = "Security zone alarm restored: ";
+          char zoneNumber[3];
+          itoa((zoneIndex + 1), zoneNumber, 10);                     // Determines the zone number
+          strcat(pushMessage, zoneNumber);
+          sendPush(pushMessage);
         }
       }
     }
@@ -158,16 +158,13 @@ void loop() {
     setLights(partition);
     setStatus(partition);
 
-    if (dsc.fireChanged[partition]) {
-      dsc.fireChanged[partition] = false;  // Resets the fire status flag
+    if (dsc.partitionChanged[partition] & dscFireChanged) {
+      dsc.partitionChanged[partition] &= ~dscFireChanged;  // Resets the fire status flag
       printFire(partition);
     }
 
-    // Zone status is stored in the openZones[] and openZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   openZones[0] and openZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   openZones[1] and openZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   openZones[7] and openZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone status is stored in openZones and openZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.openZonesStatusChanged || force_send_status_for_new_client) {
       dsc.openZonesStatusChanged = false;  // Resets the open zones status flag
 
@@ -175,24 +172,21 @@ void loop() {
         char outas[512];
         StaticJsonDocument<200> doc;
         JsonObject root = doc.to<JsonObject>();
-        root["open_zone_0"] = dsc.openZones[0];
-        root["open_zone_1"] = dsc.openZones[1];
-        root["open_zone_2"] = dsc.openZones[2];
-        root["open_zone_3"] = dsc.openZones[3];
-        root["open_zone_4"] = dsc.openZones[4];
-        root["open_zone_5"] = dsc.openZones[5];
-        root["open_zone_6"] = dsc.openZones[6];
-        root["open_zone_7"] = dsc.openZones[7];
+        root["open_zone_0"] = (byte)dsc.openZones;
+        root["open_zone_1"] = (byte)(dsc.openZones >> 8);
+        root["open_zone_2"] = (byte)(dsc.openZones >> 16);
+        root["open_zone_3"] = (byte)(dsc.openZones >> 24);
+        root["open_zone_4"] = (byte)(dsc.openZones >> 32);
+        root["open_zone_5"] = (byte)(dsc.openZones >> 40);
+        root["open_zone_6"] = (byte)(dsc.openZones >> 48);
+        root["open_zone_7"] = (byte)(dsc.openZones >> 56);
         serializeJson(root, outas);
         ws.textAll(outas);
       }
     }
 
-    // Zone alarm status is stored in the alarmZones[] and alarmZonesChanged[] arrays using 1 bit per zone, up to 64 zones
-    //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-    //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-    //   ...
-    //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
+    // Zone alarm status is stored in alarmZones and alarmZonesChanged using 1 bit per zone, up to 64 zones:
+    //   Bit 0 = Zone 1 ... Bit 63 = Zone 64
     if (dsc.alarmZonesStatusChanged || force_send_status_for_new_client) {
       dsc.alarmZonesStatusChanged = false;  // Resets the alarm zones status flag
 
@@ -200,14 +194,14 @@ void loop() {
         char outas[512];
         StaticJsonDocument<200> doc;
         JsonObject root = doc.to<JsonObject>();
-        root["alarm_zone_0"] = dsc.alarmZones[0];
-        root["alarm_zone_1"] = dsc.alarmZones[1];
-        root["alarm_zone_2"] = dsc.alarmZones[2];
-        root["alarm_zone_3"] = dsc.alarmZones[3];
-        root["alarm_zone_4"] = dsc.alarmZones[4];
-        root["alarm_zone_5"] = dsc.alarmZones[5];
-        root["alarm_zone_6"] = dsc.alarmZones[6];
-        root["alarm_zone_7"] = dsc.alarmZones[7];
+        root["alarm_zone_0"] = (byte)dsc.alarmZones;
+        root["alarm_zone_1"] = (byte)(dsc.alarmZones >> 8);
+        root["alarm_zone_2"] = (byte)(dsc.alarmZones >> 16);
+        root["alarm_zone_3"] = (byte)(dsc.alarmZones >> 24);
+        root["alarm_zone_4"] = (byte)(dsc.alarmZones >> 32);
+        root["alarm_zone_5"] = (byte)(dsc.alarmZones >> 40);
+        root["alarm_zone_6"] = (byte)(dsc.alarmZones >> 48);
+        root["alarm_zone_7"] = (byte)(dsc.alarmZones >> 56);
         serializeJson(root, outas);
         ws.textAll(outas);
       }
@@ -252,97 +246,32 @@ void changedPartition(byte partition) {
 
 
 void setLights(byte partition) {
-  if ((dsc.lights[partition] != ligths_sent || force_send_status_for_new_client) && ws.count()) {
+  if ((dsc.partitions[partition].lights != ligths_sent || force_send_status_for_new_client) && ws.count()) {
     char outas[128];
     StaticJsonDocument<200> doc;
     JsonObject root = doc.to<JsonObject>();
-    root["status_packet"] = dsc.lights[partition];
+    root["status_packet"] = dsc.partitions[partition].lights;
     serializeJson(root, outas);
     ws.textAll(outas);
-    ligths_sent = dsc.lights[partition];
+    ligths_sent = dsc.partitions[partition].lights;
   }
 }
 
 
 void setStatus(byte partition) {
   static byte lastStatus[8];
-  if (!partitionChanged && dsc.status[partition] == lastStatus[partition] && !force_send_status_for_new_client) return;
-  lastStatus[partition] = dsc.status[partition];
+  if (!partitionChanged && dsc.partitions[partition].status == lastStatus[partition] && !force_send_status_for_new_client) return;
+  lastStatus[partition] = dsc.partitions[partition].status;
 
   if (ws.count()) {
     char outas[128];
     StaticJsonDocument<200> doc;
     JsonObject root = doc.to<JsonObject>();
 
-    switch (dsc.status[partition]) {
-      case 0x01: root["lcd_lower"] = "Ready"; break;
-      case 0x02: root["lcd_lower"] = "Stay zones open"; break;
-      case 0x03: root["lcd_lower"] = "Zones open"; break;
-      case 0x04: root["lcd_lower"] = "Armed stay"; break;
-      case 0x05: root["lcd_lower"] = "Armed away"; break;
-      case 0x07: root["lcd_lower"] = "Failed to arm"; break;
-      case 0x08: root["lcd_lower"] = "Exit delay"; break;
-      case 0x09: root["lcd_lower"] = "No entry delay"; break;
-      case 0x0B: root["lcd_lower"] = "Quick exit"; break;
-      case 0x0C: root["lcd_lower"] = "Entry delay"; break;
-      case 0x0D: root["lcd_lower"] = "Alarm memory"; break;
-      case 0x10: root["lcd_lower"] = "Keypad lockout"; break;
-      case 0x11: root["lcd_lower"] = "Alarm"; break;
-      case 0x14: root["lcd_lower"] = "Auto-arm"; break;
-      case 0x16: root["lcd_lower"] = "No entry delay"; break;
-      case 0x22: root["lcd_lower"] = "Alarm memory"; break;
-      case 0x33: root["lcd_lower"] = "Busy"; break;
-      case 0x3D: root["lcd_lower"] = "Disarmed"; break;
-      case 0x3E: root["lcd_lower"] = "Disarmed"; break;
-      case 0x40: root["lcd_lower"] = "Keypad blanked"; break;
-      case 0x8A: root["lcd_lower"] = "Activate zones"; break;
-      case 0x8B: root["lcd_lower"] = "Quick exit"; break;
-      case 0x8E: root["lcd_lower"] = "Invalid option"; break;
-      case 0x8F: root["lcd_lower"] = "Invalid code"; break;
-      case 0x9E: root["lcd_lower"] = "Enter * code"; break;
-      case 0x9F: root["lcd_lower"] = "Access code"; break;
-      case 0xA0: root["lcd_lower"] = "Zone bypass"; break;
-      case 0xA1: root["lcd_lower"] = "Trouble menu"; break;
-      case 0xA2: root["lcd_lower"] = "Alarm memory"; break;
-      case 0xA3: root["lcd_lower"] = "Door chime on"; break;
-      case 0xA4: root["lcd_lower"] = "Door chime off"; break;
-      case 0xA5: root["lcd_lower"] = "Master code"; break;
-      case 0xA6: root["lcd_lower"] = "Access codes"; break;
-      case 0xA7: root["lcd_lower"] = "Enter new code"; break;
-      case 0xA9: root["lcd_lower"] = "User function"; break;
-      case 0xAA: root["lcd_lower"] = "Time and Date"; break;
-      case 0xAB: root["lcd_lower"] = "Auto-arm time"; break;
-      case 0xAC: root["lcd_lower"] = "Auto-arm on"; break;
-      case 0xAD: root["lcd_lower"] = "Auto-arm off"; break;
-      case 0xAF: root["lcd_lower"] = "System test"; break;
-      case 0xB0: root["lcd_lower"] = "Enable DLS"; break;
-      case 0xB2: root["lcd_lower"] = "Command output"; break;
-      case 0xB7: root["lcd_lower"] = "Installer code"; break;
-      case 0xB8: root["lcd_lower"] = "Enter * code"; break;
-      case 0xB9: root["lcd_lower"] = "Zone tamper"; break;
-      case 0xBA: root["lcd_lower"] = "Zones low batt."; break;
-      case 0xC6: root["lcd_lower"] = "Zone fault menu"; break;
-      case 0xC8: root["lcd_lower"] = "Service required"; break;
-      case 0xD0: root["lcd_lower"] = "Keypads low batt"; break;
-      case 0xD1: root["lcd_lower"] = "Wireless low bat"; break;
-      case 0xE4: root["lcd_lower"] = "Installer menu"; break;
-      case 0xE5: root["lcd_lower"] = "Keypad slot"; break;
-      case 0xE6: root["lcd_lower"] = "Input: 2 digits"; break;
-      case 0xE7: root["lcd_lower"] = "Input: 3 digits"; break;
-      case 0xE8: root["lcd_lower"] = "Input: 4 digits"; break;
-      case 0xEA: root["lcd_lower"] = "Code: 2 digits"; break;
-      case 0xEB: root["lcd_lower"] = "Code: 4 digits"; break;
-      case 0xEC: root["lcd_lower"] = "Input: 6 digits"; break;
-      case 0xED: root["lcd_lower"] = "Input: 32 digits"; break;
-      case 0xEE: root["lcd_lower"] = "Input: option"; break;
-      case 0xF0: root["lcd_lower"] = "Function key 1"; break;
-      case 0xF1: root["lcd_lower"] = "Function key 2"; break;
-      case 0xF2: root["lcd_lower"] = "Function key 3"; break;
-      case 0xF3: root["lcd_lower"] = "Function key 4"; break;
-      case 0xF4: root["lcd_lower"] = "Function key 5"; break;
-      case 0xF8: root["lcd_lower"] = "Keypad program"; break;
-      default: root["lcd_lower"] = dsc.status[partition];
-    }
+    // Short status message from the library for the keypad display
+    const __FlashStringHelper *statusMessage = dscStatusMessage(dsc.partitions[partition].status, true);
+    if (statusMessage != NULL) root["lcd_lower"] = statusMessage;
+    else root["lcd_lower"] = dsc.partitions[partition].status;
     serializeJson(root, outas);
     ws.textAll(outas);
   }
@@ -350,7 +279,7 @@ void setStatus(byte partition) {
 
 
 void printFire(byte partition) {
-  if (dsc.fire[partition]) {
+  if (dsc.partitions[partition].fire) {
     //    lcd.clear();
     //    byte position = strlen(lcdPartition);
     //    lcd.print(0, 0, lcdPartition);
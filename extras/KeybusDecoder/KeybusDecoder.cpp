@@ -0,0 +1,533 @@
+/*
+ *  DSC Keybus Decoder
+ *
+ *  Decodes binary captures written by printPanelCapture() and printModuleCapture() (the KeybusReader examples
+ *  with captureOutput, or KeybusSimulator -x) to text, CSV, or JSON on a Linux host, using the library's own
+ *  print functions through the Arduino API shim of the KeybusSimulator.
+ *
+ *  The capture file is memory-mapped and split into chunks at frame boundaries, and chunks are decoded in
+ *  parallel by worker processes - the library keeps its state in static members, so each worker is a separate
+ *  process with its own copy.  Each chunk is written to a temporary file and copied to stdout in order.
+ *
+ *  Panel capture times are micros() on the sketch and wrap every 71.6 minutes.  A first pass over the chunks finds
+ *  where the time wraps so that times count up from the start of the capture - this assumes the panel sends a
+ *  command at least once every 71 minutes.  Keypad and module data uses the time of the preceding panel command.
+ *
+ *  Usage: KeybusDecoder [options] capture.bin
+ *    -f format    Output format: text (default), csv, or json
+ *    -j workers   Number of worker processes (default: number of CPUs)
+ *    -c MB        Chunk size in megabytes of capture per worker task (default: 4)
+ *    -t           Displays trailing bits, as displayTrailingBits in the library
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <vector>
+#include "Arduino.h"
+#include "dscKeybusInterface.h"
+
+dscKeybusInterface dsc(D1, D2);
+
+enum outputFormat { formatText, formatCSV, formatJSON };
+
+// Results of a chunk, shared between the workers and the parent
+struct chunkResult {
+  bool hasTime;                  // True if the chunk has panel commands
+  uint32_t firstTime, lastTime;  // First and last panel capture time
+  uint64_t timeWraps;            // Times the capture time wraps within the chunk
+  uint64_t timeBase;             // Set by the parent: capture time at the start of the chunk in 64-bit micros()
+  unsigned long panelFrames, moduleFrames, overflowFrames, invalidFrames;
+};
+
+struct decodeChunk {
+  const byte *start, *end;
+  FILE *output;
+  pid_t worker;
+  bool done;
+};
+
+static outputFormat format = formatText;
+static const uint64_t timeWrap = 0x100000000ULL;
+
+
+/*
+ *  Output
+ */
+
+// Collects printed output in memory and writes it to a file in large blocks
+class chunkStream : public Stream {
+  public:
+    chunkStream(int _fd) : fd(_fd), length(0) {}
+    ~chunkStream() { flush(); }
+
+    size_t write(uint8_t c) {
+      if (length == sizeof(buffer)) flush();
+      buffer[length++] = c;
+      return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t size) {
+      if (length + size > sizeof(buffer)) flush();
+      if (size > sizeof(buffer)) return writeAll(data, size);
+      memcpy(buffer + length, data, size);
+      length += size;
+      return size;
+    }
+    using Print::write;
+
+    void flush() {
+      writeAll(buffer, length);
+      length = 0;
+    }
+
+    // Returns the position of the next write, and removes output written since then to quote a message - the
+    // buffer is flushed first if needed to keep the message in memory
+    static const size_t maxMessage = 1024;
+    size_t mark() {
+      if (length + maxMessage > sizeof(buffer)) flush();
+      return length;
+    }
+    size_t unwrite(size_t mark, char message[]) {
+      size_t messageLength = length - mark;
+      if (messageLength > maxMessage) messageLength = maxMessage;
+      memcpy(message, buffer + mark, messageLength);
+      length = mark;
+      return messageLength;
+    }
+
+    int availableForWrite() { return sizeof(buffer) - length; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+
+  private:
+    size_t writeAll(const uint8_t *data, size_t size) {
+      size_t written = 0;
+      while (written < size) {
+        ssize_t n = ::write(fd, data + written, size - written);
+        if (n <= 0) break;
+        written += n;
+      }
+      return written;
+    }
+
+    int fd;
+    size_t length;
+    uint8_t buffer[1 << 16];
+};
+
+
+// Quotes the output written since mark() as a CSV field or JSON string
+static void printQuoted(chunkStream &output, size_t mark) {
+  char message[chunkStream::maxMessage];
+  size_t length = output.unwrite(mark, message);
+  output.write('"');
+  for (size_t i = 0; i < length; i++) {
+    char c = message[i];
+    if (format == formatCSV) {
+      if (c == '"') output.write('"');
+      output.write(c);
+    }
+    else if (c == '"' || c == '\\') {
+      output.write('\\');
+      output.write(c);
+    }
+    else if ((uint8_t)c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      output.write(escaped);
+    }
+    else output.write(c);
+  }
+  output.write('"');
+}
+
+
+static void printMessage(chunkStream &output, bool panel) {
+  size_t mark = output.mark();
+  if (panel) dsc.printPanelMessage();
+  else dsc.printModuleMessage();
+  printQuoted(output, mark);
+}
+
+
+static void printHex(chunkStream &output, const byte data[], byte count) {
+  static const char hexDigits[] = "0123456789ABCDEF";
+  for (byte i = 0; i < count; i++) {
+    if (i > 0) output.write(' ');
+    output.write(hexDigits[data[i] >> 4]);
+    output.write(hexDigits[data[i] & 0x0F]);
+  }
+}
+
+
+// Prints the panel command or keypad/module data loaded from a frame, in the KeybusReader format for text:
+//   123.45: 00000101 0 10000001 ... [0x05] Partition 1: Ready Backlight - Partition ready
+//           11111111 1 00111111 ... [Keypad] Slots active: 1
+static void printFrame(chunkStream &output, const byte frame[], byte frameLength, uint64_t time) {
+  bool panel = frame[1] == 'P';
+  bool crc = frame[2] & 0x80;
+  byte bitCount = panel ? frame[2] & 0x7F : frame[2];
+  char timestamp[32];
+  snprintf(timestamp, sizeof(timestamp), "%.2f", time / 1000000.0);
+
+  if (format == formatText) {
+    if (panel) {
+      output.print(timestamp);
+      output.print(": ");
+      dsc.printPanelBinary();
+      output.print(" [");
+      dsc.printPanelCommand();
+      output.print("] ");
+      dsc.printPanelMessage();
+    }
+    else {
+      output.print("           ");
+      dsc.printModuleBinary();
+      output.print(" ");
+      dsc.printModuleMessage();
+    }
+    output.println();
+    return;
+  }
+
+  // The data bytes as written in the frame after the header, including the byte with any trailing bits
+  const byte *data = panel ? dsc.panelData : dsc.moduleData;
+  byte dataCount = frameLength - (panel ? 8 : 5);
+  byte command = panel ? dsc.panelData[0] : dsc.moduleCmd;
+  byte sequence = panel ? dsc.panelSequence : dsc.moduleSequence;
+  char fields[128];
+
+  if (format == formatCSV) {
+    snprintf(fields, sizeof(fields), "%s,%s,%u,%s,%u,0x%02X,", timestamp, panel ? "panel" : "module", sequence,
+             panel ? (crc ? "valid" : "invalid") : "", bitCount, command);
+    output.print(fields);
+    printHex(output, data, dataCount);
+    output.write(',');
+    printMessage(output, panel);
+  }
+  else {
+    snprintf(fields, sizeof(fields), "{\"time\":%s,\"type\":\"%s\",\"sequence\":%u,", timestamp,
+             panel ? "panel" : "module", sequence);
+    output.print(fields);
+    if (panel) output.print(crc ? "\"crc\":true," : "\"crc\":false,");
+    snprintf(fields, sizeof(fields), "\"bits\":%u,\"command\":\"0x%02X\",\"data\":\"", bitCount, command);
+    output.print(fields);
+    printHex(output, data, dataCount);
+    output.print("\",\"message\":");
+    printMessage(output, panel);
+    output.write('}');
+  }
+  output.println();
+}
+
+
+// Prints a buffer overflow marker as KeybusReader does, at the time of the preceding panel command
+static void printOverflow(chunkStream &output, uint64_t time) {
+  char fields[96];
+  if (format == formatText) output.print("Keybus buffer overflow");
+  else if (format == formatCSV) {
+    snprintf(fields, sizeof(fields), "%.2f,overflow,,,,,,\"Keybus buffer overflow\"", time / 1000000.0);
+    output.print(fields);
+  }
+  else {
+    snprintf(fields, sizeof(fields), "{\"time\":%.2f,\"type\":\"overflow\",\"message\":\"Keybus buffer overflow\"}",
+             time / 1000000.0);
+    output.print(fields);
+  }
+  output.println();
+}
+
+
+/*
+ *  Capture frames
+ */
+
+// Decodes the COBS frame ending at the next 0x00, returns the decoded length or 0 if the frame is not valid, and
+// advances position past the 0x00
+static byte readFrame(const byte *&position, const byte *end, byte frame[]) {
+  const byte *frameEnd = (const byte *)memchr(position, 0, end - position);
+  if (frameEnd == NULL) frameEnd = end;
+  const byte *encoded = position;
+  position = frameEnd < end ? frameEnd + 1 : end;
+
+  size_t encodedLength = frameEnd - encoded;
+  if (encodedLength < 2 || encodedLength > dscReadSize + 9) return 0;
+
+  byte frameLength = 0;
+  size_t i = 0;
+  while (i < encodedLength) {
+    byte code = encoded[i++];
+    if (i + code - 1 > encodedLength) return 0;
+    for (byte j = 1; j < code; j++) frame[frameLength++] = encoded[i++];
+    if (i < encodedLength) frame[frameLength++] = 0;
+  }
+  return frameLength;
+}
+
+
+// Panel capture time of a frame without loading it
+static bool frameTime(const byte frame[], byte frameLength, uint32_t &time) {
+  if (frameLength < 8 || frame[0] != frameLength || frame[1] != 'P') return false;
+  time = 0;
+  for (byte i = 0; i < 4; i++) time |= (uint32_t)frame[4 + i] << (i * 8);
+  return true;
+}
+
+
+// First pass: finds the capture time range and wraps of the chunk
+static void scanChunk(const decodeChunk &chunk, chunkResult &result) {
+  byte frame[dscReadSize + 16];
+  const byte *position = chunk.start;
+  result.hasTime = false;
+  result.timeWraps = 0;
+  while (position < chunk.end) {
+    uint32_t time;
+    byte frameLength = readFrame(position, chunk.end, frame);
+    if (!frameTime(frame, frameLength, time)) continue;
+    if (!result.hasTime) {
+      result.hasTime = true;
+      result.firstTime = time;
+    }
+    else if (time < result.lastTime) result.timeWraps++;
+    result.lastTime = time;
+  }
+}
+
+
+// Second pass: prints each frame with the library
+static void decodeChunkFrames(const decodeChunk &chunk, chunkResult &result) {
+  chunkStream output(fileno(chunk.output));
+  dsc.begin(output);
+
+  byte frame[dscReadSize + 16];
+  const byte *position = chunk.start;
+  uint64_t time = result.timeBase;
+  uint32_t previousTime = result.firstTime;
+  result.panelFrames = result.moduleFrames = result.overflowFrames = result.invalidFrames = 0;
+
+  while (position < chunk.end) {
+    byte frameLength = readFrame(position, chunk.end, frame);
+    byte frameType = frameLength ? dsc.loadCapture(frame, frameLength) : 0;
+    if (frameType == 'P') {
+      result.panelFrames++;
+      uint32_t panelTime = dsc.panelTime;
+      if (panelTime < previousTime) time += timeWrap;
+      time = (time & ~(timeWrap - 1)) | panelTime;
+      previousTime = panelTime;
+      printFrame(output, frame, frameLength, time);
+    }
+    else if (frameType == 'M') {
+      result.moduleFrames++;
+      printFrame(output, frame, frameLength, time);
+    }
+    else if (frameType == 'O') {
+      result.overflowFrames++;
+      printOverflow(output, time);
+    }
+    else result.invalidFrames++;
+  }
+}
+
+
+/*
+ *  Worker pool
+ */
+
+// Runs the function for each chunk in a pool of worker processes.  If output is set, each finished chunk is
+// copied to stdout in order and at most workers chunks are waiting to be copied at a time.
+static bool runWorkers(std::vector<decodeChunk> &chunks, chunkResult *results, unsigned int workers,
+                       void (*function)(const decodeChunk &chunk, chunkResult &result), bool output) {
+  size_t nextChunk = 0, copiedChunk = 0, runningWorkers = 0;
+  bool success = true;
+
+  for (decodeChunk &chunk : chunks) chunk.done = false;
+  while (copiedChunk < chunks.size()) {
+    while (nextChunk < chunks.size() && nextChunk - copiedChunk < workers && runningWorkers < workers) {
+      decodeChunk &chunk = chunks[nextChunk];
+      chunk.output = output ? tmpfile() : NULL;
+      if (output && chunk.output == NULL) return false;
+      fflush(stdout);
+      chunk.worker = fork();
+      if (chunk.worker < 0) return false;
+      if (chunk.worker == 0) {
+        function(chunk, results[nextChunk]);
+        _exit(0);
+      }
+      nextChunk++;
+      runningWorkers++;
+    }
+
+    int status;
+    pid_t worker = wait(&status);
+    if (worker < 0) return false;
+    runningWorkers--;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) success = false;
+    for (size_t i = copiedChunk; i < nextChunk; i++) {
+      if (chunks[i].worker == worker) chunks[i].done = true;
+    }
+
+    while (copiedChunk < nextChunk && chunks[copiedChunk].done) {
+      decodeChunk &chunk = chunks[copiedChunk];
+      if (output) {
+        static byte buffer[1 << 20];
+        int fd = fileno(chunk.output);
+        lseek(fd, 0, SEEK_SET);
+        ssize_t n;
+        while ((n = read(fd, buffer, sizeof(buffer))) > 0) {
+          if (fwrite(buffer, 1, n, stdout) != (size_t)n) success = false;
+        }
+        fclose(chunk.output);
+      }
+      copiedChunk++;
+    }
+  }
+  return success;
+}
+
+
+// Splits the capture into chunks of about chunkSize bytes, each ending after a 0x00 frame delimiter
+static void splitChunks(const byte *capture, size_t captureSize, size_t chunkSize, std::vector<decodeChunk> &chunks) {
+  const byte *position = capture;
+  const byte *end = capture + captureSize;
+  while (position < end) {
+    decodeChunk chunk = {};
+    chunk.start = position;
+    if ((size_t)(end - position) <= chunkSize) chunk.end = end;
+    else {
+      const byte *delimiter = (const byte *)memchr(position + chunkSize, 0, end - position - chunkSize);
+      chunk.end = delimiter != NULL ? delimiter + 1 : end;
+    }
+    chunks.push_back(chunk);
+    position = chunk.end;
+  }
+}
+
+
+int main(int argc, char *argv[]) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned int workers = cpus > 0 ? cpus : 1;
+  size_t chunkSize = 4 << 20;
+
+  int option;
+  while ((option = getopt(argc, argv, "f:j:c:t")) != -1) {
+    switch (option) {
+      case 'f':
+        if (strcmp(optarg, "text") == 0) format = formatText;
+        else if (strcmp(optarg, "csv") == 0) format = formatCSV;
+        else if (strcmp(optarg, "json") == 0) format = formatJSON;
+        else {
+          fprintf(stderr, "Unknown format: %s\n", optarg);
+          return 1;
+        }
+        break;
+      case 'j': workers = strtoul(optarg, NULL, 10); break;
+      case 'c': chunkSize = strtoul(optarg, NULL, 10) << 20; break;
+      case 't': dsc.displayTrailingBits = true; break;
+      default:
+        fprintf(stderr, "Usage: %s [-f text|csv|json] [-j workers] [-c chunk_MB] [-t] capture.bin\n", argv[0]);
+        return 1;
+    }
+  }
+  if (optind != argc - 1) {
+    fprintf(stderr, "Usage: %s [-f text|csv|json] [-j workers] [-c chunk_MB] [-t] capture.bin\n", argv[0]);
+    return 1;
+  }
+  if (workers == 0) workers = 1;
+  if (chunkSize == 0) chunkSize = 1 << 20;
+
+  int fd = open(argv[optind], O_RDONLY);
+  struct stat captureStat;
+  if (fd < 0 || fstat(fd, &captureStat) != 0) {
+    fprintf(stderr, "Unable to read %s\n", argv[optind]);
+    return 1;
+  }
+  size_t captureSize = captureStat.st_size;
+  const byte *capture = NULL;
+  if (captureSize > 0) {
+    capture = (const byte *)mmap(NULL, captureSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (capture == MAP_FAILED) {
+      fprintf(stderr, "Unable to map %s\n", argv[optind]);
+      return 1;
+    }
+    madvise((void *)capture, captureSize, MADV_SEQUENTIAL);
+  }
+  close(fd);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<decodeChunk> chunks;
+  splitChunks(capture, captureSize, chunkSize, chunks);
+
+  // Results are written by the workers to shared memory
+  size_t resultsSize = (chunks.size() + 1) * sizeof(chunkResult);
+  chunkResult *results = (chunkResult *)mmap(NULL, resultsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (results == MAP_FAILED) {
+    fprintf(stderr, "Unable to allocate results\n");
+    return 1;
+  }
+
+  if (format == formatCSV) printf("time,type,sequence,crc,bits,command,data,message\n");
+  bool success = runWorkers(chunks, results, workers, scanChunk, false);
+
+  // Sets the capture time at the start of each chunk from the wraps found in the first pass
+  uint64_t timeBase = 0;
+  bool previousTime = false;
+  uint32_t lastTime = 0;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    if (!results[i].hasTime) {
+      results[i].firstTime = lastTime;
+      results[i].timeBase = timeBase | lastTime;
+      continue;
+    }
+    if (previousTime && results[i].firstTime < lastTime) timeBase += timeWrap;
+    results[i].timeBase = timeBase | results[i].firstTime;
+    timeBase += results[i].timeWraps * timeWrap;
+    lastTime = results[i].lastTime;
+    previousTime = true;
+  }
+
+  success = success && runWorkers(chunks, results, workers, decodeChunkFrames, true);
+  fflush(stdout);
+  double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  unsigned long panelFrames = 0, moduleFrames = 0, overflowFrames = 0, invalidFrames = 0;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    panelFrames += results[i].panelFrames;
+    moduleFrames += results[i].moduleFrames;
+    overflowFrames += results[i].overflowFrames;
+    invalidFrames += results[i].invalidFrames;
+  }
+  unsigned long frames = panelFrames + moduleFrames;
+  fprintf(stderr, "Capture:             %.1f MB in %zu chunks, %u workers\n", captureSize / 1000000.0, chunks.size(), workers);
+  fprintf(stderr, "Panel commands:      %lu\n", panelFrames);
+  fprintf(stderr, "Module commands:     %lu\n", moduleFrames);
+  fprintf(stderr, "Buffer overflows:    %lu\n", overflowFrames);
+  fprintf(stderr, "Invalid frames:      %lu\n", invalidFrames);
+  fprintf(stderr, "Wall time:           %.3f s (%.0f frames/s, %.1f MB/s)\n", wallSeconds, frames / wallSeconds,
+          captureSize / 1000000.0 / wallSeconds);
+
+  if (!success) {
+    fprintf(stderr, "Decoding failed\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+/*
+    DSC Keybus Simulator - Arduino API shim
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+static uint64_t virtualTime;
+static uint8_t pinLevels[32];
+static void (*pinInterrupts[32])();
+static void (*timerInterrupt)();
+static bool timerArmed;
+static uint64_t timerExpire;
+
+
+void simSetTime(uint64_t timeMicros) { virtualTime = timeMicros; }
+uint64_t simTime() { return virtualTime; }
+void simSetPin(uint8_t pin, uint8_t level) { if (pin < 32) pinLevels[pin] = level; }
+uint8_t simOutputPin(uint8_t pin) { return pin < 32 ? pinLevels[pin] : LOW; }
+void (*simPinInterrupt(uint8_t pin))() { return pin < 32 ? pinInterrupts[pin] : NULL; }
+
+
+bool simTimerPending(uint64_t &expireMicros) {
+  expireMicros = timerExpire;
+  return timerArmed && timerInterrupt != NULL;
+}
+
+
+void simTimerFire() {
+  timerArmed = false;
+  if (timerInterrupt != NULL) timerInterrupt();
+}
+
+
+unsigned long millis() { return (unsigned long)(virtualTime / 1000); }
+unsigned long micros() { return (unsigned long)virtualTime; }
+void delay(unsigned long ms) { virtualTime += ms * 1000; }
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+int digitalRead(uint8_t pin) { return pin < 32 ? pinLevels[pin] : LOW; }
+void digitalWrite(uint8_t pin, uint8_t value) { if (pin < 32) pinLevels[pin] = value ? HIGH : LOW; }
+
+simGpioOutput GPOS = {HIGH};
+simGpioOutput GPOC = {LOW};
+
+uint32_t simGpioInput() {
+  uint32_t levels = 0;
+  for (uint8_t pin = 0; pin < 16; pin++) if (pinLevels[pin]) levels |= 1UL << pin;
+  return levels;
+}
+
+simGpioOutput &simGpioOutput::operator=(uint32_t mask) {
+  for (uint8_t pin = 0; pin < 16; pin++) if (mask & (1UL << pin)) pinLevels[pin] = level;
+  return *this;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode) {
+  (void)mode;
+  if (interrupt < 32) pinInterrupts[interrupt] = isr;
+}
+
+void detachInterrupt(uint8_t interrupt) { if (interrupt < 32) pinInterrupts[interrupt] = NULL; }
+
+// Interrupts are only ever delivered between calls into the sketch, so these are not needed
+void noInterrupts() {}
+void interrupts() {}
+
+void timer1_isr_init() {}
+void timer1_attachInterrupt(void (*isr)()) { timerInterrupt = isr; }
+void timer1_enable(uint8_t divider, uint8_t intType, uint8_t reload) { (void)divider; (void)intType; (void)reload; }
+void timer1_disable() { timerArmed = false; }
+
+void timer1_write(uint32_t ticks) {
+  timerExpire = virtualTime + (ticks / 5);
+  timerArmed = true;
+}
+
+
+char *itoa(int value, char *str, int base) {
+  if (base == 10) sprintf(str, "%d", value);
+  else if (base == 16) sprintf(str, "%x", value);
+  else sprintf(str, "%o", value);
+  return str;
+}
+
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+
+size_t Print::print(long value, int base) {
+  if (base == DEC && value < 0) {
+    size_t n = print('-');
+    return n + printNumber((unsigned long)(-value), DEC);
+  }
+  return printNumber((unsigned long)value, base);
+}
+
+
+size_t Print::print(unsigned long value, int base) {
+  return printNumber(value, base);
+}
+
+
+size_t Print::print(double value, int digits) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+  return write(buffer);
+}
+
+
+size_t Print::printNumber(unsigned long value, uint8_t base) {
+  char buffer[8 * sizeof(long) + 1];
+  char *str = &buffer[sizeof(buffer) - 1];
+  *str = '\0';
+  if (base < 2) base = 10;
+  do {
+    char digit = value % base;
+    value /= base;
+    *--str = digit < 10 ? digit + '0' : digit + 'A' - 10;
+  } while (value);
+  return write(str);
+}
+
+
+size_t HardwareSerial::write(uint8_t c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+
+void HardwareSerial::flush() {
+  fflush(stdout);
+}
@@ -0,0 +1,194 @@
+/*
+    DSC Keybus Simulator - Arduino API shim
+
+    Provides the subset of the Arduino and esp8266 core API used by the library so that the library sources can be
+    compiled and run on a Linux host.  Pins, interrupts, the esp8266 timer1 one-shot, and micros()/millis()
+    are all driven by a virtual timeline controlled by the simulator - see KeybusSimulator.cpp.
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// The library is built using its esp8266 configuration
+#ifndef ESP8266
+#define ESP8266
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define CHANGE 0x3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// NodeMCU/Wemos pin names as GPIO numbers
+#define D1 5
+#define D2 4
+#define D8 15
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+#define PSTR(string_literal) (string_literal)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+void noInterrupts();
+void interrupts();
+
+char *itoa(int value, char *str, int base);
+
+// esp8266 GPIO registers for direct port access: GPI reads GPIO 0-15, writing a bit mask to GPOS/GPOC sets the
+// pins high/low
+struct simGpioOutput {
+  bool level;
+  simGpioOutput &operator=(uint32_t mask);
+};
+uint32_t simGpioInput();
+#define GPI (simGpioInput())
+extern simGpioOutput GPOS;
+extern simGpioOutput GPOC;
+
+// esp8266 timer1 - TIM_DIV16 at 80MHz runs at 5MHz, 0.2us per tick
+#define TIM_DIV1 0
+#define TIM_DIV16 1
+#define TIM_DIV256 3
+#define TIM_EDGE 0
+#define TIM_LEVEL 1
+#define TIM_SINGLE 0
+#define TIM_LOOP 1
+void timer1_isr_init();
+void timer1_attachInterrupt(void (*isr)());
+void timer1_enable(uint8_t divider, uint8_t intType, uint8_t reload);
+void timer1_disable();
+void timer1_write(uint32_t ticks);
+
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper *ifsh) { return write(reinterpret_cast<const char *>(ifsh)); }
+    size_t print(const char str[]) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println() { return write("\n"); }
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template <typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+
+  private:
+    size_t printNumber(unsigned long value, uint8_t base);
+};
+
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+
+// Serial writes to stdout
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+    using Print::write;
+    int availableForWrite() { return 4096; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush();
+};
+
+extern HardwareSerial Serial;
+
+
+/*
+ *  Simulator controls for the virtual timeline, pins, and interrupts
+ */
+
+// Sets the virtual time in microseconds returned by micros() and millis()
+void simSetTime(uint64_t timeMicros);
+uint64_t simTime();
+
+// Sets the level of an input pin, as driven by the Keybus
+void simSetPin(uint8_t pin, uint8_t level);
+
+// Returns the level of an output pin, as driven by the library
+uint8_t simOutputPin(uint8_t pin);
+
+// Returns the handler attached to a pin by attachInterrupt(), or NULL
+void (*simPinInterrupt(uint8_t pin))();
+
+// Returns true if the timer1 one-shot is armed and sets the virtual time it expires
+bool simTimerPending(uint64_t &expireMicros);
+
+// Runs the timer1 one-shot handler, disarming the timer as with TIM_SINGLE
+void simTimerFire();
+
+#endif  // Arduino_h
@@ -0,0 +1,624 @@
+/*
+ *  DSC Keybus Simulator
+ *
+ *  Runs the library on a Linux host by driving dscClockInterrupt() and the timer1 dscDataInterrupt() from a
+ *  virtual micros()/millis() timeline, while a simulated sketch calls handlePanel() and handleModule() at a
+ *  configurable loop interval.  This measures capture and decoding performance without hardware and runs much
+ *  faster than real-time.
+ *
+ *  Keybus data is generated from one of:
+ *    - Synthetic traffic: a busy panel sending status, zone, time, and keypad query commands with random zone
+ *      and partition activity (default).
+ *    - KeybusReader logs (-r): the binary data printed by the KeybusReader example, for example:
+ *        12.50: 00000101 0 10000001 00000001 10010001 11000111 [0x05] Partition 1 ...
+ *    - Edge captures (-e): one line per sample from a logic analyzer export, "<time in us> <clock> <data>".
+ *
+ *  Usage: KeybusSimulator [options]
+ *    -n frames    Synthetic commands to generate (default: 100000)
+ *    -s seed      Synthetic traffic random seed (default: 1)
+ *    -b           Synthetic traffic without repeated commands, every command is new data for the buffer
+ *    -r file      Replays panel and module data from a KeybusReader log
+ *    -e file      Replays clock and data edges from a capture
+ *    -l us        Sketch loop interval in virtual microseconds between handlePanel() calls (default: 100)
+ *    -c commands  Sketch calls handlePanelBatch() to process up to this many commands per loop
+ *    -m           Enables processModuleData
+ *    -k           Sets status change callbacks for all zones, partitions, and trouble
+ *    -p           Prints decoded panel and module messages as the KeybusReader example, and events with dscEvents
+ *    -d           Saves panel commands with getPanelRecord() and prints them after the run, timed by capture time
+ *    -o bytes     Prints through a dscBufferedStream limited to this many bytes per second of virtual time, 0 for
+ *                 unlimited - lines that do not fit in the buffer are dropped and counted in the results
+ *    -x           Writes panel and module data as binary capture frames with printPanelCapture() and
+ *                 printModuleCapture() instead of printing messages, and buffer overflows with printOverflowCapture()
+ *    -t           Tests the capture round trip: sends commands of every length with keypad data, and checks that each
+ *                 panel and module command reloaded from its capture frame with loadCapture() prints the same binary
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "dscKeybusInterface.h"
+
+#define dscClockPin D1
+#define dscReadPin D2
+#define dscWritePin D8
+dscKeybusInterface dsc(dscClockPin, dscReadPin, dscWritePin);
+
+// Keybus timing: 1kHz clock, panel data changes after the clock rises and keypad/module data changes after the
+// clock falls (observed latency up to 160us), commands are separated by the clock held high.
+const unsigned long clockHalfPeriod = 500;
+const unsigned long commandGap = 2500;
+const unsigned long panelLatency = 20;
+const unsigned long moduleLatency = 120;
+
+struct keybusCommand {
+  std::vector<byte> panelBits;
+  std::vector<byte> moduleBits;
+};
+
+struct simStats {
+  unsigned long commandsSent;
+  unsigned long loopCalls;
+  unsigned long panelCommands;
+  unsigned long moduleCommands;
+  unsigned long bufferOverflows;
+  unsigned long events;
+  unsigned long callbacks;
+  unsigned long eventsDropped;
+  unsigned long captureFrames;
+  unsigned long captureErrors;
+  double handlePanelTotal;
+  double handlePanelMax;
+  double bufferLatencyTotal;
+  unsigned long bufferLatencyMax;
+};
+
+static simStats stats;
+static unsigned long loopInterval = 100;
+static bool printMessages = false;
+static bool recordMessages = false;
+static bool captureMessages = false;
+static bool captureTest = false;
+static std::vector<dscPanelRecord> panelRecords;
+static Stream *output = &Serial;
+static dscBufferedStream *bufferedOutput = NULL;
+static byte batchCommands = 0;
+static uint64_t nextLoopTime;
+static uint64_t timeline;
+
+
+/*
+ *  Simulated sketch
+ */
+
+static void printModule() {
+  output->print("           ");
+  dsc.printModuleBinary();
+  output->print(" ");
+  dsc.printModuleMessage();
+  output->println();
+}
+
+
+// Collects printed output in memory for the capture round trip test, set with -t
+class memoryStream : public Stream {
+  public:
+    size_t write(uint8_t c) { data.push_back(c); return 1; }
+    using Print::write;
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    std::string data;
+};
+
+static memoryStream testStream;
+
+
+// Prints the panel or module binary, writes the capture frame, and reloads the frame with loadCapture() - the
+// binary printed from the reloaded data must match, including trailing bits
+static void checkCapture(bool panel) {
+  stats.captureFrames++;
+  testStream.data.clear();
+  if (panel) dsc.printPanelBinary();
+  else dsc.printModuleBinary();
+  std::string binary = testStream.data;
+
+  testStream.data.clear();
+  if (panel) dsc.printPanelCapture();
+  else dsc.printModuleCapture();
+
+  // COBS decoding: each code byte is the distance to the next 0x00, the frame ends with 0x00
+  const std::string &encoded = testStream.data;
+  byte frame[dscReadSize + 16];
+  byte frameLength = 0;
+  size_t i = 0;
+  while (i + 1 < encoded.size() && frameLength < dscReadSize + 8) {
+    byte code = encoded[i++];
+    for (byte j = 1; j < code && i < encoded.size(); j++) frame[frameLength++] = encoded[i++];
+    if (i + 1 < encoded.size()) frame[frameLength++] = 0;
+  }
+
+  testStream.data.clear();
+  if (dsc.loadCapture(frame, frameLength) == (panel ? 'P' : 'M')) {
+    if (panel) dsc.printPanelBinary();
+    else dsc.printModuleBinary();
+  }
+  if (testStream.data != binary) {
+    stats.captureErrors++;
+    fprintf(stderr, "Capture mismatch: %s \"%s\", reloaded \"%s\"\n", panel ? "panel" : "module", binary.c_str(),
+            testStream.data.c_str());
+  }
+}
+
+
+// Status change callbacks, set with -k
+static void printEvent(const char *source, const dscEvent &event) {
+  output->print("           ");
+  output->print(source);
+  output->print(" ");
+  output->print(event.type);
+  output->print(" ");
+  output->print(event.number);
+  output->print(": ");
+  output->println(event.value);
+}
+
+
+static void statusCallback(const dscEvent &event) {
+  stats.callbacks++;
+  if (printMessages) printEvent("Callback", event);
+}
+
+
+static void sketchLoop() {
+  stats.loopCalls++;
+
+  auto start = std::chrono::steady_clock::now();
+  byte panelCommands;
+  if (batchCommands > 0) panelCommands = dsc.handlePanelBatch(batchCommands, 2000);
+  else panelCommands = dsc.handlePanel();
+  double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  stats.handlePanelTotal += elapsed;
+  if (elapsed > stats.handlePanelMax) stats.handlePanelMax = elapsed;
+
+  if (panelCommands > 0) {
+    stats.panelCommands += panelCommands;
+    unsigned long bufferLatency = (uint32_t)(micros() - dsc.panelTime);  // panelTime is 32-bit as on hardware
+    stats.bufferLatencyTotal += bufferLatency;
+    if (bufferLatency > stats.bufferLatencyMax) stats.bufferLatencyMax = bufferLatency;
+    if (dsc.bufferOverflow) {
+      stats.bufferOverflows++;
+      if (captureMessages) dsc.printOverflowCapture();
+      else if (printMessages) output->println(F("Keybus buffer overflow"));
+    }
+    dsc.bufferOverflow = false;
+
+    if (captureTest) checkCapture(true);
+    else if (captureMessages) dsc.printPanelCapture();
+    else if (recordMessages) {
+      dscPanelRecord record;
+      dsc.getPanelRecord(record);
+      panelRecords.push_back(record);
+    }
+    else if (printMessages) {
+      output->print(millis() / 1000.0, 2);
+      output->print(": ");
+      dsc.printPanelBinary();
+      output->print(" [");
+      dsc.printPanelCommand();
+      output->print("] ");
+      dsc.printPanelMessage();
+      output->println();
+    }
+  }
+
+  if (dsc.handleModule()) {
+    stats.moduleCommands++;
+    if (captureTest) checkCapture(false);
+    else if (captureMessages) dsc.printModuleCapture();
+    else if (printMessages) printModule();
+  }
+
+  // Status events from the library event queue - build with: make CXXFLAGS="-O2 -DdscEvents"
+  #if defined(dscEvents)
+  dscEvent event;
+  while (dsc.getEvent(event)) {
+    stats.events++;
+    if (printMessages) printEvent("Event", event);
+  }
+  stats.eventsDropped += dsc.eventsDropped;
+  dsc.eventsDropped = 0;
+  #endif
+
+  if (bufferedOutput != NULL) bufferedOutput->update();
+}
+
+
+// Prints panel commands saved with -d, after the run
+static void printPanelRecords() {
+  for (const dscPanelRecord &record : panelRecords) {
+    output->print(record.time / 1000000.0, 2);
+    output->print(": ");
+    dsc.printPanelBinary(record);
+    output->print(" [");
+    dsc.printPanelCommand(record);
+    output->print("] ");
+    dsc.printPanelMessage(record);
+    output->println();
+  }
+}
+
+
+/*
+ *  Virtual timeline
+ */
+
+// Runs timer interrupts and sketch loop iterations scheduled before the specified time
+static void advanceTo(uint64_t eventTime) {
+  while (true) {
+    uint64_t timerTime;
+    bool timerPending = simTimerPending(timerTime);
+    if (timerPending && timerTime <= eventTime && timerTime <= nextLoopTime) {
+      simSetTime(timerTime);
+      simTimerFire();
+    }
+    else if (nextLoopTime <= eventTime) {
+      simSetTime(nextLoopTime);
+      sketchLoop();
+      nextLoopTime += loopInterval;
+    }
+    else break;
+  }
+  simSetTime(eventTime);
+}
+
+
+static void setData(uint64_t eventTime, byte level) {
+  advanceTo(eventTime);
+  simSetPin(dscReadPin, level);
+}
+
+
+static void setClock(uint64_t eventTime, byte level) {
+  advanceTo(eventTime);
+  simSetPin(dscClockPin, level);
+  void (*clockInterrupt)() = simPinInterrupt(dscClockPin);
+  if (clockInterrupt != NULL) clockInterrupt();
+}
+
+
+// Sends a command: the falling clock ends the gap after the previous command, followed by one clock cycle per
+// bit with the panel bit while the clock is high and the module bit while the clock is low
+static void sendCommand(const keybusCommand &command) {
+  setClock(timeline, LOW);
+  setData(timeline + moduleLatency, HIGH);
+  timeline += clockHalfPeriod;
+
+  for (size_t bit = 0; bit < command.panelBits.size(); bit++) {
+    setClock(timeline, HIGH);
+    setData(timeline + panelLatency, command.panelBits[bit]);
+    timeline += clockHalfPeriod;
+
+    byte moduleBit = bit < command.moduleBits.size() ? command.moduleBits[bit] : HIGH;
+    setClock(timeline, LOW);
+    setData(timeline + moduleLatency, moduleBit);
+    timeline += clockHalfPeriod;
+  }
+
+  setClock(timeline, HIGH);
+  setData(timeline + panelLatency, HIGH);
+  timeline += commandGap;
+  stats.commandsSent++;
+}
+
+
+// Finishes the last command and lets the sketch drain the buffer
+static void finish() {
+  setClock(timeline, LOW);
+  timeline += clockHalfPeriod;
+  setClock(timeline, HIGH);
+  timeline += 100000;
+  advanceTo(timeline);
+}
+
+
+/*
+ *  Keybus data
+ */
+
+// Converts Keybus bytes to bits - byte 1 is the stop bit by itself as stored in panelData[], keypads and modules
+// do not send the stop bit
+static void appendBytes(std::vector<byte> &bits, const byte *data, byte length, bool stopBit) {
+  for (byte dataByte = 0; dataByte < length; dataByte++) {
+    if (dataByte == 1) {
+      if (stopBit) bits.push_back(data[1] & 0x01);
+    }
+    else {
+      for (int bit = 7; bit >= 0; bit--) bits.push_back(bitRead(data[dataByte], bit));
+    }
+  }
+}
+
+
+static keybusCommand makeCommand(std::vector<byte> panelBytes, bool crc, const std::vector<byte> &moduleBytes = {}) {
+  if (crc) {
+    int dataSum = 0;
+    for (size_t i = 0; i < panelBytes.size(); i++) if (i != 1) dataSum += panelBytes[i];
+    panelBytes.push_back(dataSum % 256);
+  }
+  keybusCommand command;
+  appendBytes(command.panelBits, panelBytes.data(), panelBytes.size(), true);
+  if (!moduleBytes.empty()) appendBytes(command.moduleBits, moduleBytes.data(), moduleBytes.size(), false);
+  return command;
+}
+
+
+// Generates traffic similar to a PC1864 with 4 partitions and 64 zones: 0x05 status is sent constantly and
+// interleaved with zone status, keypad queries, and the date/time, with random zone and partition changes.
+static void runSynthetic(unsigned long commandCount, unsigned int seed, bool uniqueCommands) {
+  srand(seed);
+  byte zones[8] = {0};
+  byte partitionStatus[4] = {0x01, 0x01, 0x01, 0x01};
+  byte partitionLights[4] = {0x81, 0x81, 0x81, 0x81};
+  const byte zoneCommands[4] = {0x27, 0x2D, 0x34, 0x3E};
+  const byte extendedZones[4] = {0x09, 0x0B, 0x0D, 0x0F};
+  const byte statusMessages[6] = {0x01, 0x03, 0x04, 0x05, 0x08, 0x3E};
+  byte minute = 0;
+
+  for (unsigned long commandIndex = 0; commandIndex < commandCount; commandIndex++) {
+
+    // Random zone and partition activity
+    if (uniqueCommands || rand() % 8 == 0) {
+      byte zone = rand() % 64;
+      zones[zone / 8] ^= 1 << (zone % 8);
+      byte partition = rand() % 4;
+      partitionStatus[partition] = statusMessages[rand() % sizeof(statusMessages)];
+      partitionLights[partition] = partitionStatus[partition] == 0x01 ? 0x81 : 0x82;
+    }
+
+    switch (commandIndex % 8) {
+      case 0:
+      case 2:
+      case 4:
+      case 6:
+        sendCommand(makeCommand({0x05, 0x00, partitionLights[0], partitionStatus[0], partitionLights[1], partitionStatus[1],
+                                 partitionLights[2], partitionStatus[2], partitionLights[3], partitionStatus[3]}, false));
+        break;
+
+      case 1:
+      case 5: {
+        byte group = (commandIndex / 8) % 4;
+        sendCommand(makeCommand({zoneCommands[group], 0x00, partitionLights[0], partitionStatus[0], partitionLights[1], partitionStatus[1], zones[group]}, true));
+        break;
+      }
+
+      case 3: {
+        byte group = (commandIndex / 8) % 4;
+        sendCommand(makeCommand({0xE6, 0x00, extendedZones[group], zones[group + 4]}, true));
+        break;
+      }
+
+      case 7:
+        if ((commandIndex / 8) % 16 == 0) {
+          minute = (minute + 1) % 60;
+          sendCommand(makeCommand({0xA5, 0x00, 0x18, 0x4F, 0xB0, (byte)(minute << 2), 0x00, 0x00}, true));
+        }
+        else {
+          sendCommand(makeCommand({0x11, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA}, false,
+                                  {0xFF, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF}));
+        }
+        break;
+    }
+  }
+}
+
+
+// Sends commands of every length from 8 bits to dscReadSize bytes, each with keypad data for the full command, to
+// test capture frames with each panel and module bit count
+static void runCaptureTest(unsigned long commandCount, unsigned int seed) {
+  srand(seed);
+  const unsigned int lengths = dscReadSize * 8 - 7;
+  for (unsigned long commandIndex = 0; commandIndex < commandCount; commandIndex++) {
+    keybusCommand command;
+    unsigned int bitCount = 8 + commandIndex % lengths;
+    for (unsigned int bit = 0; bit < bitCount; bit++) {
+      command.panelBits.push_back(rand() % 2);
+      command.moduleBits.push_back(rand() % 2);
+    }
+    command.panelBits[0] = HIGH;   // Commands 0x80 and up, not the 0x05 and 0x1B status commands skipped as redundant
+    command.moduleBits[0] = LOW;   // Keypads and modules send data by pulling the data line low
+    sendCommand(command);
+  }
+}
+
+
+// Replays KeybusReader logs - panel lines include the command in brackets, other lines are module data
+static bool runReaderLog(const char *fileName) {
+  FILE *file = fopen(fileName, "r");
+  if (file == NULL) return false;
+
+  char line[1024];
+  keybusCommand command;
+  bool pendingCommand = false;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    std::vector<byte> bits;
+    std::vector<byte> moduleBits;
+    bool binaryFound = false;
+    char *token = strtok(line, " \t\r\n");
+    while (token != NULL && token[0] != '[') {
+      size_t length = strlen(token);
+      if (strspn(token, "01.") == length && (length == 1 || length == 8)) {
+        for (size_t i = 0; i < length; i++) {
+          byte bit = token[i] == '0' ? LOW : HIGH;  // Hidden keypad digits are sent as 1
+          bits.push_back(bit);
+          if (length == 8) moduleBits.push_back(bit);
+        }
+        binaryFound = true;
+      }
+      else if (binaryFound) break;
+      token = strtok(NULL, " \t\r\n");
+    }
+    if (!binaryFound) continue;
+
+    if (token != NULL && strncmp(token, "[0x", 3) == 0) {
+      if (pendingCommand) sendCommand(command);
+      command.panelBits = bits;
+      command.moduleBits.clear();
+      pendingCommand = true;
+    }
+    else if (pendingCommand) command.moduleBits = moduleBits;
+  }
+  if (pendingCommand) sendCommand(command);
+  fclose(file);
+  return true;
+}
+
+
+// Replays clock and data samples, calling the clock interrupt on each clock change
+static bool runEdgeCapture(const char *fileName) {
+  FILE *file = fopen(fileName, "r");
+  if (file == NULL) return false;
+
+  unsigned long long sampleTime;
+  unsigned int clock, data;
+  int previousClock = -1;
+  uint64_t startTime = timeline;
+  while (fscanf(file, "%llu %u %u", &sampleTime, &clock, &data) == 3) {
+    uint64_t eventTime = startTime + sampleTime;
+    if (eventTime < timeline) eventTime = timeline;
+    setData(eventTime, data ? HIGH : LOW);
+    if ((int)clock != previousClock) {
+      setClock(eventTime, clock ? HIGH : LOW);
+      previousClock = clock;
+    }
+    timeline = eventTime;
+  }
+  fclose(file);
+  return true;
+}
+
+
+int main(int argc, char *argv[]) {
+  unsigned long commandCount = 100000;
+  unsigned int seed = 1;
+  bool uniqueCommands = false;
+  const char *readerLog = NULL;
+  const char *edgeCapture = NULL;
+  bool moduleData = false;
+  bool callbacks = false;
+  bool bufferOutput = false;
+  unsigned long outputRate = 0;
+
+  int option;
+  while ((option = getopt(argc, argv, "n:s:br:e:l:c:mkpdo:xt")) != -1) {
+    switch (option) {
+      case 'n': commandCount = strtoul(optarg, NULL, 10); break;
+      case 's': seed = strtoul(optarg, NULL, 10); break;
+      case 'b': uniqueCommands = true; break;
+      case 'r': readerLog = optarg; break;
+      case 'e': edgeCapture = optarg; break;
+      case 'l': loopInterval = strtoul(optarg, NULL, 10); break;
+      case 'c': batchCommands = strtoul(optarg, NULL, 10) > 255 ? 255 : strtoul(optarg, NULL, 10); break;
+      case 'm': moduleData = true; break;
+      case 'k': callbacks = true; break;
+      case 'p': printMessages = true; break;
+      case 'd': recordMessages = true; break;
+      case 'o': outputRate = strtoul(optarg, NULL, 10); bufferOutput = true; break;
+      case 'x': captureMessages = true; break;
+      case 't': captureTest = true; break;
+      default:
+        fprintf(stderr, "Usage: %s [-n frames] [-s seed] [-b] [-r keybusreader.log] [-e edges.txt] [-l loop_us] [-c commands] [-m] [-k] [-p] [-d] [-o bytes_per_second] [-x] [-t]\n", argv[0]);
+        return 1;
+    }
+  }
+  if (loopInterval == 0) loopInterval = 1;
+
+  // Starts with the Keybus idle and the clock high
+  simSetPin(dscClockPin, HIGH);
+  simSetPin(dscReadPin, HIGH);
+  dsc.processModuleData = moduleData;
+  if (callbacks) {
+    dsc.onZoneChange(statusCallback);
+    dsc.onZoneAlarm(statusCallback);
+    dsc.onPartitionChange(statusCallback);
+    dsc.onTrouble(statusCallback);
+  }
+  static byte outputBuffer[4096];
+  static dscBufferedStream outputStream(Serial, outputBuffer, sizeof(outputBuffer), outputRate);
+  if (bufferOutput && !captureMessages) {  // Binary frames are not split into lines
+    bufferedOutput = &outputStream;
+    output = bufferedOutput;
+  }
+  if (captureTest) {
+    dsc.processModuleData = true;
+    dsc.displayTrailingBits = true;
+    dsc.begin(testStream);
+  }
+  else dsc.begin(*output);
+  timeline = commandGap;
+  nextLoopTime = timeline;
+
+  auto start = std::chrono::steady_clock::now();
+  bool inputRead = true;
+  if (readerLog != NULL) inputRead = runReaderLog(readerLog);
+  else if (edgeCapture != NULL) inputRead = runEdgeCapture(edgeCapture);
+  else if (captureTest) runCaptureTest(commandCount, seed);
+  else runSynthetic(commandCount, seed, uniqueCommands);
+  if (!inputRead) {
+    fprintf(stderr, "Unable to read %s\n", readerLog != NULL ? readerLog : edgeCapture);
+    return 1;
+  }
+  finish();
+  double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double virtualSeconds = timeline / 1000000.0;
+  printPanelRecords();
+  output->flush();
+
+  fprintf(stderr, "Virtual time:        %.2f s (%.0fx real-time)\n", virtualSeconds, virtualSeconds / wallSeconds);
+  fprintf(stderr, "Wall time:           %.3f s\n", wallSeconds);
+  if (edgeCapture == NULL) fprintf(stderr, "Commands sent:       %lu\n", stats.commandsSent);
+  fprintf(stderr, "Panel commands:      %lu (%.1f/s virtual, %.0f/s wall)\n", stats.panelCommands,
+          stats.panelCommands / virtualSeconds, stats.panelCommands / wallSeconds);
+  fprintf(stderr, "Buffer latency:      avg %.0f us, max %lu us\n",
+          stats.panelCommands ? stats.bufferLatencyTotal / stats.panelCommands : 0.0, stats.bufferLatencyMax);
+  fprintf(stderr, "Module commands:     %lu\n", stats.moduleCommands);
+  fprintf(stderr, "Buffer overflows:    %lu\n", stats.bufferOverflows);
+  fprintf(stderr, "handlePanel() calls: %lu, avg %.1f ns, max %.0f ns\n", stats.loopCalls,
+          stats.loopCalls ? stats.handlePanelTotal / stats.loopCalls : 0.0, stats.handlePanelMax);
+
+  if (callbacks) fprintf(stderr, "Callbacks:           %lu\n", stats.callbacks);
+  if (captureTest) fprintf(stderr, "Capture errors:      %lu of %lu frames\n", stats.captureErrors, stats.captureFrames);
+  if (bufferedOutput != NULL) {
+    fprintf(stderr, "Output dropped:      %lu lines, %lu bytes\n", bufferedOutput->droppedLines, bufferedOutput->droppedBytes);
+  }
+  #if defined(dscEvents)
+  fprintf(stderr, "Events:              %lu, dropped %lu\n", stats.events, stats.eventsDropped);
+  #endif
+
+  // Interrupt timing from the library instrumentation - build with: make CXXFLAGS="-O2 -DdscTimingStats"
+  #if defined(dscTimingStats)
+  dscTimingData timing;
+  dsc.getTiming(timing);
+  fprintf(stderr, "Data samples:        %lu, late %lu, missed %lu\n", timing.samples, timing.lateSamples, timing.missedSamples);
+  fprintf(stderr, "Sample delay:        min %u us, max %u us, histogram", timing.sampleDelayMin, timing.sampleDelayMax);
+  for (byte i = 0; i < dscTimingBins; i++) fprintf(stderr, " %lu", timing.sampleDelayBins[i]);
+  fprintf(stderr, "\n");
+  #endif
+  return (captureTest && stats.captureErrors > 0) ? 1 : 0;
+}
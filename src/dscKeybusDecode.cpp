@@ -0,0 +1,124 @@
+/*
+    DSC Keybus Interface - Keybus decoders
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dscKeybusDecode.h"
+
+
+// Decodes the lights and status message of each partition: 0x05 carries partitions 1-2, or 1-4 in the longer
+// command sent by panels with more than 2 partitions, 0x1B carries partitions 5-8, and 0x27 carries partitions 1-2
+bool dscDecodePanelStatus(const byte panelData[], byte panelByteCount, dscPanelStatus &status) {
+  switch (panelData[0]) {
+    case 0x05:
+      status.partitionStart = 0;
+      if (panelByteCount < 9) status.partitionCount = 2;
+      else status.partitionCount = 4;
+      break;
+    case 0x1B:
+      status.partitionStart = 4;
+      status.partitionCount = 4;
+      break;
+    case 0x27:
+      status.partitionStart = 0;
+      status.partitionCount = 2;
+      break;
+    default: return false;
+  }
+
+  for (byte partitionIndex = 0; partitionIndex < status.partitionCount; partitionIndex++) {
+    status.lights[partitionIndex] = panelData[(partitionIndex * 2) + 2];
+    status.messages[partitionIndex] = panelData[(partitionIndex * 2) + 3];
+  }
+  for (byte partitionIndex = status.partitionCount; partitionIndex < 4; partitionIndex++) {
+    status.lights[partitionIndex] = 0;
+    status.messages[partitionIndex] = 0;
+  }
+
+  // The trouble light is only used with status messages 0x01-0x04 and 0xC7, it is intermittent in other states
+  status.trouble = (panelData[2] & 0x10) != 0;
+  status.troubleStable = panelData[3] < 0x05 || panelData[3] == 0xC7;
+  return true;
+}
+
+
+bool dscDecodePanelZones(const byte panelData[], dscPanelZones &zones) {
+  switch (panelData[0]) {
+    case 0x27: zones.zoneGroup = 0; break;  // Zones 1-8
+    case 0x2D: zones.zoneGroup = 1; break;  // Zones 9-16
+    case 0x34: zones.zoneGroup = 2; break;  // Zones 17-24
+    case 0x3E: zones.zoneGroup = 3; break;  // Zones 25-32
+    case 0xE6:
+      switch (panelData[2]) {
+        case 0x09: zones.zoneGroup = 4; break;  // Zones 33-40
+        case 0x0B: zones.zoneGroup = 5; break;  // Zones 41-48
+        case 0x0D: zones.zoneGroup = 6; break;  // Zones 49-56
+        case 0x0F: zones.zoneGroup = 7; break;  // Zones 57-64
+        default: return false;
+      }
+      zones.zoneStatus = panelData[3];
+      return true;
+    default: return false;
+  }
+  zones.zoneStatus = panelData[6];
+  return true;
+}
+
+
+// Decodes the panel time and status message: 0xA5 sets the partition in the 2 upper bits of the month byte, 0xEB
+// sets one bit per partition in a separate byte
+bool dscDecodePanelMessage(const byte panelData[], dscPanelMessage &message) {
+  byte timeByte;
+  switch (panelData[0]) {
+    case 0xA5: timeByte = 2; break;
+    case 0xEB: timeByte = 3; break;
+    default: return false;
+  }
+
+  message.command = panelData[0];
+  byte dscYear3 = panelData[timeByte] >> 4;
+  byte dscYear4 = panelData[timeByte] & 0x0F;
+  message.year = (dscYear3 * 10) + dscYear4;
+  message.month = panelData[timeByte + 1] << 2; message.month >>= 4;
+  byte dscDay1 = panelData[timeByte + 1] << 6; dscDay1 >>= 3;
+  byte dscDay2 = panelData[timeByte + 2] >> 5;
+  message.day = dscDay1 | dscDay2;
+  message.hour = panelData[timeByte + 2] & 0x1F;
+  message.minute = panelData[timeByte + 3] >> 2;
+
+  if (message.command == 0xA5) {
+    message.timestamp = panelData[6] == 0 && panelData[7] == 0;
+    message.partition = panelData[3] >> 6;
+    message.type = panelData[5] & 0x03;
+    message.code = panelData[6];
+  }
+  else {
+    message.timestamp = false;
+    switch (panelData[2]) {
+      case 0x01: message.partition = 1; break;
+      case 0x02: message.partition = 2; break;
+      case 0x04: message.partition = 3; break;
+      case 0x08: message.partition = 4; break;
+      case 0x10: message.partition = 5; break;
+      case 0x20: message.partition = 6; break;
+      case 0x40: message.partition = 7; break;
+      case 0x80: message.partition = 8; break;
+      default: message.partition = 0; break;
+    }
+    message.type = panelData[7] & 0x07;
+    message.code = panelData[8];
+  }
+  return true;
+}
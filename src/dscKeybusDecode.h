@@ -0,0 +1,66 @@
+/*
+    DSC Keybus Interface - Keybus decoders
+
+    Decodes panel commands into small structs without changing any interface status, so the decoders can be
+    used on their own by host tools, benchmarks, and fuzzers.  dscKeybusInterface applies the decoded results to
+    its status in dscKeybusProcessData.cpp.
+
+    This library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef dscKeybusDecode_h
+#define dscKeybusDecode_h
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <stdint.h>
+typedef uint8_t byte;
+#endif
+
+
+// Partition lights and status messages from 0x05 (partitions 1-4), 0x1B (partitions 5-8), and 0x27 (partitions 1-2)
+struct dscPanelStatus {
+  byte partitionStart;  // Index of the first partition in the command: 0 = Partition 1, 4 = Partition 5
+  byte partitionCount;  // Number of partitions in the command
+  byte lights[4];       // Status lights of each partition, lights[0] = partitionStart
+  byte messages[4];     // Status message of each partition
+  bool trouble;         // Trouble light
+  bool troubleStable;   // False while the status message shows an intermittent trouble light
+};
+
+// Open status of a group of 8 zones from 0x27, 0x2D, 0x34, 0x3E, and 0xE6
+struct dscPanelZones {
+  byte zoneGroup;   // 0 = Zones 1-8 ... 7 = Zones 57-64
+  byte zoneStatus;  // Bit 0 = first zone in the group ... Bit 7 = last zone in the group
+};
+
+// Timestamped status messages from 0xA5 (partitions 1-2) and 0xEB (partitions 1-8)
+struct dscPanelMessage {
+  byte command;     // 0xA5 or 0xEB
+  byte year, month, day, hour, minute;
+  bool timestamp;   // True if the command only sets the panel time
+  byte partition;   // 1 = Partition 1 ... 8 = Partition 8, 0 = not specific to a partition (0xA5) or unknown (0xEB)
+  byte type;        // Message type from the command, selects how code is interpreted: 0x00, 0x02, or 0x04
+  byte code;        // Message code
+};
+
+
+// Each decoder reads a panel command as captured in dscKeybusInterface::panelData[], returning false if the
+// command does not contain that type of data.  panelData[] must hold at least 10 bytes, CRC is not checked.
+bool dscDecodePanelStatus(const byte panelData[], byte panelByteCount, dscPanelStatus &status);
+bool dscDecodePanelZones(const byte panelData[], dscPanelZones &zones);
+bool dscDecodePanelMessage(const byte panelData[], dscPanelMessage &message);
+
+#endif  // dscKeybusDecode_h
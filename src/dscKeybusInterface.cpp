@@ -17,9 +17,44 @@
 
 #include "dscKeybusInterface.h"
 
+static_assert(dscConfigPartitions >= 1 && dscConfigPartitions <= 8, "dscConfigPartitions must be 1-8");
+static_assert(dscConfigZones >= 1 && dscConfigZones <= 8, "dscConfigZones must be 1-8");
+static_assert(dscConfigBufferSize >= 1 && dscConfigBufferSize <= 255, "dscConfigBufferSize must be 1-255");
+static_assert(dscConfigModuleBufferSize >= 2 && dscConfigModuleBufferSize <= 255, "dscConfigModuleBufferSize must be 2-255");
+static_assert(dscConfigEventBufferSize >= 2 && dscConfigEventBufferSize <= 255, "dscConfigEventBufferSize must be 2-255");
+static_assert(dscBufferBytes - 1 <= (dscBufferIndex)~0, "dscBufferSize is too large for dscBufferIndex");
+static_assert(dscReadSize <= 16, "dscReadSize is too large to store the CRC result with the bit count");
+static_assert(dscZones * 8 <= sizeof(dscZoneWord) * 8, "dscZones is too large for dscZoneWord");
+
+// Reads and writes the Keybus pins in the interrupts using the port registers and bit masks set in begin(), this
+// skips the pin lookups done by digitalRead() and digitalWrite() on every clock change
+#if defined(__AVR__)
+#define clockPinHigh() (*clockPinRegister & clockPinMask)
+#define readPinHigh() (*readPinRegister & readPinMask)
+#define writePinHigh() (*writePinRegister |= writePinMask)
+#define writePinLow() (*writePinRegister &= ~writePinMask)
+#elif defined(ESP8266)
+#define clockPinHigh() (GPI & clockPinMask)
+#define readPinHigh() (readPinMask ? (GPI & readPinMask) : digitalRead(dscReadPin))
+#define writePinHigh() (writePinMask ? (void)(GPOS = writePinMask) : digitalWrite(dscWritePin, HIGH))
+#define writePinLow() (writePinMask ? (void)(GPOC = writePinMask) : digitalWrite(dscWritePin, LOW))
+#endif
+
 byte dscKeybusInterface::dscClockPin;
 byte dscKeybusInterface::dscReadPin;
 byte dscKeybusInterface::dscWritePin;
+#if defined(__AVR__)
+volatile uint8_t* dscKeybusInterface::clockPinRegister;
+volatile uint8_t* dscKeybusInterface::readPinRegister;
+volatile uint8_t* dscKeybusInterface::writePinRegister;
+uint8_t dscKeybusInterface::clockPinMask;
+uint8_t dscKeybusInterface::readPinMask;
+uint8_t dscKeybusInterface::writePinMask;
+#elif defined(ESP8266)
+uint32_t dscKeybusInterface::clockPinMask;
+uint32_t dscKeybusInterface::readPinMask;
+uint32_t dscKeybusInterface::writePinMask;
+#endif
 char dscKeybusInterface::writeKey;
 byte dscKeybusInterface::writePartition;
 byte dscKeybusInterface::writeByte;
@@ -29,19 +64,29 @@ bool dscKeybusInterface::processModuleData;
 byte dscKeybusInterface::panelData[dscReadSize];
 byte dscKeybusInterface::panelByteCount;
 byte dscKeybusInterface::panelBitCount;
+bool dscKeybusInterface::panelCRC;
+unsigned long dscKeybusInterface::panelTime;
+byte dscKeybusInterface::panelSequence;
 volatile bool dscKeybusInterface::writeReady;
-volatile byte dscKeybusInterface::moduleData[dscReadSize];
-volatile bool dscKeybusInterface::moduleDataCaptured;
-volatile byte dscKeybusInterface::moduleByteCount;
-volatile byte dscKeybusInterface::moduleBitCount;
+byte dscKeybusInterface::moduleData[dscReadSize];
+byte dscKeybusInterface::moduleCmd;
+byte dscKeybusInterface::moduleSequence;
+byte dscKeybusInterface::moduleByteCount;
+byte dscKeybusInterface::moduleBitCount;
 volatile bool dscKeybusInterface::writeAlarm;
 volatile bool dscKeybusInterface::writeAsterisk;
 volatile bool dscKeybusInterface::wroteAsterisk;
 volatile bool dscKeybusInterface::bufferOverflow;
-volatile byte dscKeybusInterface::panelBufferLength;
-volatile byte dscKeybusInterface::panelBuffer[dscBufferSize][dscReadSize];
-volatile byte dscKeybusInterface::panelBufferBitCount[dscBufferSize];
-volatile byte dscKeybusInterface::panelBufferByteCount[dscBufferSize];
+volatile dscBufferIndex dscKeybusInterface::panelBufferHead;
+volatile dscBufferIndex dscKeybusInterface::panelBufferTail;
+volatile byte dscKeybusInterface::panelBuffer[dscBufferBytes];
+volatile byte dscKeybusInterface::moduleBufferHead;
+volatile byte dscKeybusInterface::moduleBufferTail;
+volatile byte dscKeybusInterface::moduleBuffer[dscModuleBufferSize][dscReadSize];
+volatile byte dscKeybusInterface::moduleBufferBitCount[dscModuleBufferSize];
+volatile byte dscKeybusInterface::moduleBufferByteCount[dscModuleBufferSize];
+volatile byte dscKeybusInterface::moduleBufferCmd[dscModuleBufferSize];
+volatile byte dscKeybusInterface::moduleBufferSequence[dscModuleBufferSize];
 volatile byte dscKeybusInterface::isrPanelData[dscReadSize];
 volatile byte dscKeybusInterface::isrPanelByteCount;
 volatile byte dscKeybusInterface::isrPanelBitCount;
@@ -50,10 +95,21 @@ volatile byte dscKeybusInterface::isrModuleData[dscReadSize];
 volatile byte dscKeybusInterface::isrModuleByteCount;
 volatile byte dscKeybusInterface::isrModuleBitCount;
 volatile byte dscKeybusInterface::isrModuleBitTotal;
-volatile byte dscKeybusInterface::currentCmd;
 volatile byte dscKeybusInterface::statusCmd;
+byte dscKeybusInterface::isrPanelSequence;
+byte dscKeybusInterface::isrPanelSum;
+bool dscKeybusInterface::isrPanelCRC;
+bool dscKeybusInterface::isrRedundantData;
+byte* dscKeybusInterface::isrPreviousCmd;
+byte dscKeybusInterface::isrPreviousCmd05[dscReadSize];
+byte dscKeybusInterface::isrPreviousCmd1B[dscReadSize];
 volatile unsigned long dscKeybusInterface::clockHighTime;
 volatile unsigned long dscKeybusInterface::keybusTime;
+#if defined(dscTimingStats)
+volatile dscTimingData dscKeybusInterface::isrTiming;
+volatile bool dscKeybusInterface::isrSamplePending;
+volatile unsigned long dscKeybusInterface::isrClockTime;
+#endif
 
 
 dscKeybusInterface::dscKeybusInterface(byte setClockPin, byte setReadPin, byte setWritePin) {
@@ -66,6 +122,16 @@ dscKeybusInterface::dscKeybusInterface(byte setClockPin, byte setReadPin, byte s
   displayTrailingBits = false;
   processModuleData = false;
   writePartition = 1;
+  isrRedundantData = true;
+  zoneCallback = NULL;
+  zoneAlarmCallback = NULL;
+  partitionCallback = NULL;
+  troubleCallback = NULL;
+  #if defined(dscEvents)
+  eventHead = 0;
+  eventTail = 0;
+  eventsDropped = 0;
+  #endif
 }
 
 
@@ -75,7 +141,32 @@ void dscKeybusInterface::begin(Stream &_stream) {
   if (virtualKeypad) pinMode(dscWritePin, OUTPUT);
   stream = &_stream;
 
-  // Platform-specific timers trigger a read of the data line 250us after the Keybus clock changes
+  // Sets up direct port access to the Keybus pins for the interrupts
+  #if defined(__AVR__)
+  clockPinRegister = portInputRegister(digitalPinToPort(dscClockPin));
+  clockPinMask = digitalPinToBitMask(dscClockPin);
+  readPinRegister = portInputRegister(digitalPinToPort(dscReadPin));
+  readPinMask = digitalPinToBitMask(dscReadPin);
+  if (virtualKeypad) {
+    writePinRegister = portOutputRegister(digitalPinToPort(dscWritePin));
+    writePinMask = digitalPinToBitMask(dscWritePin);
+  }
+
+  // esp8266 GPIO 0-15 are read from GPI and written with GPOS/GPOC.  GPIO 16 (D0) is not on these registers and is
+  // left with a mask of 0 to fall back to digitalRead()/digitalWrite() - it has no interrupt and cannot be the clock pin.
+  #elif defined(ESP8266)
+  clockPinMask = 1UL << dscClockPin;
+  readPinMask = (dscReadPin < 16) ? 1UL << dscReadPin : 0;
+  if (virtualKeypad) writePinMask = (dscWritePin < 16) ? 1UL << dscWritePin : 0;
+  #endif
+
+  #if defined(dscTimingStats)
+  resetTiming();
+  #endif
+
+  // Platform-specific timers trigger a read of the data line 250us after the Keybus clock changes, edge capture
+  // reads the data line in dscClockInterrupt() and leaves the timers unused
+  #if !defined(dscEdgeCapture)
 
   // Arduino Timer1 calls ISR(TIMER1_OVF_vect) from dscClockInterrupt() and is disabled in the ISR for a one-shot timer
   #if defined(__AVR__)
@@ -89,6 +180,7 @@ void dscKeybusInterface::begin(Stream &_stream) {
   timer1_attachInterrupt(dscDataInterrupt);
   timer1_enable(TIM_DIV16, TIM_EDGE, TIM_SINGLE);
   #endif
+  #endif  // dscEdgeCapture
 
   // Generates an interrupt when the Keybus clock rises or falls - requires a hardware interrupt pin on Arduino
   attachInterrupt(digitalPinToInterrupt(dscClockPin), dscClockInterrupt, CHANGE);
@@ -106,6 +198,7 @@ bool dscKeybusInterface::handlePanel() {
     previousKeybus = keybusConnected;
     keybusChanged = true;
     statusChanged = true;
+    processEvent(dscEventKeybus, 0, keybusConnected, micros());
     if (!keybusConnected) return true;
   }
 
@@ -113,23 +206,32 @@ bool dscKeybusInterface::handlePanel() {
   if (writeKeysPending) writeKeys(writeKeysArray);
 
   // Skips processing if the panel data buffer is empty
-  if (panelBufferLength == 0) return false;
-
-  // Copies data from the buffer to panelData[]
-  static byte panelBufferIndex = 1;
-  byte dataIndex = panelBufferIndex - 1;
-  for (byte i = 0; i < dscReadSize; i++) panelData[i] = panelBuffer[dataIndex][i];
-  panelBitCount = panelBufferBitCount[dataIndex];
-  panelByteCount = panelBufferByteCount[dataIndex];
-  panelBufferIndex++;
-
-  // Resets counters when the buffer is cleared
-  noInterrupts();
-  if (panelBufferIndex > panelBufferLength) {
-    panelBufferIndex = 1;
-    panelBufferLength = 0;
+  dscBufferIndex bufferTail = panelBufferTail;
+  if (bufferTail == panelBufferHead) return false;
+
+  // Copies data from the buffer to panelData[]: bit count with the CRC result in bit 7, sequence number, capture
+  // time, and the bytes read including any trailing bits
+  panelBitCount = panelBuffer[bufferTail] & 0x7F;
+  panelCRC = panelBuffer[bufferTail] & 0x80;
+  if (++bufferTail == dscBufferBytes) bufferTail = 0;
+  panelSequence = panelBuffer[bufferTail];
+  if (++bufferTail == dscBufferBytes) bufferTail = 0;
+  panelTime = 0;
+  for (byte i = 0; i < 4; i++) {
+    panelTime |= (unsigned long)panelBuffer[bufferTail] << (i * 8);
+    if (++bufferTail == dscBufferBytes) bufferTail = 0;
   }
-  interrupts();
+  panelByteCount = (panelBitCount + 7) / 8;  // Byte 0, the stop bit in byte 1, then 8 bits per byte
+  byte dataCount = panelByteCount + 1;
+  if (dataCount > dscReadSize) dataCount = dscReadSize;
+  for (byte i = 0; i < dataCount; i++) {
+    panelData[i] = panelBuffer[bufferTail];
+    if (++bufferTail == dscBufferBytes) bufferTail = 0;
+  }
+  for (byte i = dataCount; i < dscReadSize; i++) panelData[i] = 0;
+
+  // Releases the buffer space to dscDataInterrupt() after the data has been copied
+  panelBufferTail = bufferTail;
 
   // Waits at startup for the 0x05 status command or a command with valid CRC data to eliminate spurious data.
   static bool firstClockCycle = true;
@@ -211,31 +313,80 @@ bool dscKeybusInterface::handlePanel() {
     }
   }
 
-  // Processes valid panel data
+  // Decodes valid panel data and applies it to the status, 0x05 and 0x1B do not include a CRC
+  dscPanelStatus panelStatus;
+  dscPanelZones panelZones;
+  dscPanelMessage panelMessage;
   switch (panelData[0]) {
     case 0x05:
-    case 0x1B: processPanelStatus(); break;
-    case 0x27: processPanel_0x27(); break;
-    case 0x2D: processPanel_0x2D(); break;
-    case 0x34: processPanel_0x34(); break;
-    case 0x3E: processPanel_0x3E(); break;
-    case 0xA5: processPanel_0xA5(); break;
-    case 0xE6: if (dscPartitions > 2) processPanel_0xE6(); break;
-    case 0xEB: if (dscPartitions > 2) processPanel_0xEB(); break;
+    case 0x1B:
+      if (dscDecodePanelStatus(panelData, panelByteCount, panelStatus)) processPanelStatus(panelStatus);
+      break;
+
+    case 0x27:  // Status with zone 1-8 info
+      if (!validCRC()) break;
+      if (dscDecodePanelStatus(panelData, panelByteCount, panelStatus)) processPanelArmed(panelStatus);
+      if (dscDecodePanelZones(panelData, panelZones)) processOpenZones(panelZones.zoneGroup, panelZones.zoneStatus);
+      break;
+
+    case 0x2D:  // Status with zone 9-16 info
+    case 0x34:  // Status with zone 17-24 info
+    case 0x3E:  // Status with zone 25-32 info
+      if (validCRC() && dscDecodePanelZones(panelData, panelZones)) processOpenZones(panelZones.zoneGroup, panelZones.zoneStatus);
+      break;
+
+    case 0xE6:  // Status with zone 33-64 info
+      if (dscPartitions > 2 && validCRC() && dscDecodePanelZones(panelData, panelZones)) processOpenZones(panelZones.zoneGroup, panelZones.zoneStatus);
+      break;
+
+    case 0xA5:  // Date, time, and status for partitions 1-2
+      if (validCRC() && dscDecodePanelMessage(panelData, panelMessage)) processPanelMessage(panelMessage);
+      break;
+
+    case 0xEB:  // Date, time, and status for partitions 1-8
+      if (dscPartitions > 2 && validCRC() && dscDecodePanelMessage(panelData, panelMessage)) processPanelMessage(panelMessage);
+      break;
   }
 
   return true;
 }
 
 
+// Processes buffered panel data until the buffer is empty, maxCommands have been read, or maxMicros have elapsed.  This
+// lets a sketch spend longer periods on network tasks between calls without overflowing the buffer - the status
+// flags (statusChanged, partitionChanged[], etc) remain set across commands, so after a batch they are the combined
+// changes from all of the commands processed.  panelData[] contains the last command read.
+byte dscKeybusInterface::handlePanelBatch(byte maxCommands, unsigned long maxMicros) {
+  unsigned long batchStart = micros();
+  byte validCommands = 0;
+  for (byte i = 0; i < maxCommands; i++) {
+    if (handlePanel()) validCommands++;
+    if (panelBufferTail == panelBufferHead) break;
+    if (micros() - batchStart >= maxMicros) break;
+  }
+  return validCommands;
+}
+
+
 bool dscKeybusInterface::handleModule() {
-  if (!moduleDataCaptured) return false;
-  moduleDataCaptured = false;
+
+  // Skips processing if the keypad and module data buffer is empty
+  byte bufferTail = moduleBufferTail;
+  if (bufferTail == moduleBufferHead) return false;
+
+  // Copies data from the buffer to moduleData[] and releases the buffer slot to dscDataInterrupt()
+  for (byte i = 0; i < dscReadSize; i++) moduleData[i] = moduleBuffer[bufferTail][i];
+  moduleBitCount = moduleBufferBitCount[bufferTail];
+  moduleByteCount = moduleBufferByteCount[bufferTail];
+  moduleCmd = moduleBufferCmd[bufferTail];
+  moduleSequence = moduleBufferSequence[bufferTail];
+  if (++bufferTail == dscModuleBufferSize) bufferTail = 0;
+  moduleBufferTail = bufferTail;
 
   if (moduleBitCount < 8) return false;
 
   // Skips periodic keypad slot query responses
-  if (!processRedundantData && currentCmd == 0x11) {
+  if (!processRedundantData && moduleCmd == 0x11) {
     bool redundantData = true;
     byte checkedBytes = dscReadSize;
     static byte previousSlotData[dscReadSize];
@@ -253,7 +404,7 @@ bool dscKeybusInterface::handleModule() {
   }
 
   // Determines if a keybus message is a response to a panel command
-  switch (currentCmd) {
+  switch (moduleCmd) {
     case 0x11:
     case 0x28:
     case 0xD5: queryResponse = true; break;
@@ -322,11 +473,11 @@ void dscKeybusInterface::write(const char receivedKey) {
       case 'F':
       case 'f': writeKey = 0x77; writeAlarm = true; break;                    // Keypad fire alarm
       case 's':
-      case 'S': writeKey = 0xAF; writeArm[writePartition - 1] = true; break;  // Arm stay
+      case 'S': writeKey = 0xAF; partitions[writePartition - 1].writeArm = true; break;  // Arm stay
       case 'w':
-      case 'W': writeKey = 0xB1; writeArm[writePartition - 1] = true; break;  // Arm away
+      case 'W': writeKey = 0xB1; partitions[writePartition - 1].writeArm = true; break;  // Arm away
       case 'n':
-      case 'N': writeKey = 0xB6; writeArm[writePartition - 1] = true; break;  // Arm with no entry delay (night arm)
+      case 'N': writeKey = 0xB6; partitions[writePartition - 1].writeArm = true; break;  // Arm with no entry delay (night arm)
       case 'A':
       case 'a': writeKey = 0xBB; writeAlarm = true; break;                    // Keypad auxiliary alarm
       case 'c':
@@ -387,6 +538,88 @@ void dscKeybusInterface::write(const char receivedKey) {
 }
 
 
+void dscKeybusInterface::onZoneChange(dscEventCallback callback, dscZoneWord zones) {
+  zoneCallback = callback;
+  zoneCallbackZones = zones;
+}
+
+
+void dscKeybusInterface::onZoneAlarm(dscEventCallback callback, dscZoneWord zones) {
+  zoneAlarmCallback = callback;
+  zoneAlarmCallbackZones = zones;
+}
+
+
+void dscKeybusInterface::onPartitionChange(dscEventCallback callback, byte partitions, byte changes) {
+  partitionCallback = callback;
+  partitionCallbackPartitions = partitions;
+  partitionCallbackChanges = changes;
+}
+
+
+void dscKeybusInterface::onTrouble(dscEventCallback callback) {
+  troubleCallback = callback;
+}
+
+
+#if defined(dscEvents)
+// Copies and removes the oldest queued event
+bool dscKeybusInterface::getEvent(dscEvent &event) {
+  if (eventTail == eventHead) return false;
+  event = events[eventTail];
+  if (++eventTail == dscEventBufferSize) eventTail = 0;
+  return true;
+}
+#endif
+
+
+#if defined(dscTimingStats)
+// Copies the interrupt timing statistics - interrupts are disabled so the counters are consistent with each other
+void dscKeybusInterface::getTiming(dscTimingData &timing) {
+  noInterrupts();
+  timing.samples = isrTiming.samples;
+  timing.lateSamples = isrTiming.lateSamples;
+  timing.missedSamples = isrTiming.missedSamples;
+  timing.sampleDelayMin = isrTiming.sampleDelayMin;
+  timing.sampleDelayMax = isrTiming.sampleDelayMax;
+  timing.clockInterruptMin = isrTiming.clockInterruptMin;
+  timing.clockInterruptMax = isrTiming.clockInterruptMax;
+  timing.dataInterruptMin = isrTiming.dataInterruptMin;
+  timing.dataInterruptMax = isrTiming.dataInterruptMax;
+  for (byte i = 0; i < dscTimingBins; i++) timing.sampleDelayBins[i] = isrTiming.sampleDelayBins[i];
+  interrupts();
+}
+
+
+void dscKeybusInterface::resetTiming() {
+  noInterrupts();
+  isrTiming.samples = 0;
+  isrTiming.lateSamples = 0;
+  isrTiming.missedSamples = 0;
+  isrTiming.sampleDelayMin = 0xFFFF;
+  isrTiming.sampleDelayMax = 0;
+  isrTiming.clockInterruptMin = 0xFFFF;
+  isrTiming.clockInterruptMax = 0;
+  isrTiming.dataInterruptMin = 0xFFFF;
+  isrTiming.dataInterruptMax = 0;
+  for (byte i = 0; i < dscTimingBins; i++) isrTiming.sampleDelayBins[i] = 0;
+  interrupts();
+}
+
+
+// Updates a pair of timing min/max counters from the interrupts
+#if defined(__AVR__)
+void dscKeybusInterface::recordTiming(volatile unsigned int &timingMin, volatile unsigned int &timingMax, unsigned long duration) {
+#elif defined(ESP8266)
+void ICACHE_RAM_ATTR dscKeybusInterface::recordTiming(volatile unsigned int &timingMin, volatile unsigned int &timingMax, unsigned long duration) {
+#endif
+  if (duration > 0xFFFF) duration = 0xFFFF;
+  if (duration < timingMin) timingMin = duration;
+  if (duration > timingMax) timingMax = duration;
+}
+#endif
+
+
 bool dscKeybusInterface::redundantPanelData(byte previousCmd[], volatile byte currentCmd[], byte checkedBytes) {
   bool redundantData = true;
   for (byte i = 0; i < checkedBytes; i++) {
@@ -403,14 +636,9 @@ bool dscKeybusInterface::redundantPanelData(byte previousCmd[], volatile byte cu
 }
 
 
+// Returns the CRC result for panelData[] from checkPanelByte(), the checksum is calculated as the data is read
 bool dscKeybusInterface::validCRC() {
-  byte byteCount = (panelBitCount - 1) / 8;
-  int dataSum = 0;
-  for (byte panelByte = 0; panelByte < byteCount; panelByte++) {
-    if (panelByte != 1) dataSum += panelData[panelByte];
-  }
-  if (dataSum % 256 == panelData[byteCount]) return true;
-  else return false;
+  return panelCRC;
 }
 
 
@@ -422,6 +650,25 @@ void dscKeybusInterface::dscClockInterrupt() {
 void ICACHE_RAM_ATTR dscKeybusInterface::dscClockInterrupt() {
 #endif
 
+  // Edge capture reads the data line first: data changes only after a delay following the clock change (observed
+  // 20us from the panel, up to 160us from keypads), so the line still holds the bit sent during the previous
+  // clock state.
+  #if defined(dscEdgeCapture)
+  bool dataHigh = readPinHigh();
+  #endif
+
+  // Tracks the clock change time for the sample delay and counts samples lost if the previous timer did not fire
+  #if defined(dscTimingStats)
+  unsigned long isrStartTime = micros();
+  #if !defined(dscEdgeCapture)
+  if (isrSamplePending) isrTiming.missedSamples++;
+  isrSamplePending = true;
+  isrClockTime = isrStartTime;
+  #endif
+  #endif
+
+  #if !defined(dscEdgeCapture)
+
   // Data sent from the panel and keypads/modules has latency after a clock change (observed up to 160us for keypad data).
   // The following sets up a timer for both Arduino/AVR and Arduino/esp8266 that will call dscDataInterrupt() in
   // 250us to read the data line.
@@ -435,17 +682,27 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscClockInterrupt() {
   #elif defined(ESP8266)
   timer1_write(1250);
   #endif
+  #endif  // dscEdgeCapture
 
 
   static unsigned long previousClockHighTime;
-  if (digitalRead(dscClockPin) == HIGH) {
-    if (virtualKeypad) digitalWrite(dscWritePin, LOW);  // Restores the data line after a virtual keypad write
+  if (clockPinHigh()) {
+    #if defined(dscEdgeCapture)
+    captureData(false, dataHigh);  // Keypad and module bit from the clock low that just ended
+    #endif
+
+    if (virtualKeypad) writePinLow();  // Restores the data line after a virtual keypad write
     previousClockHighTime = micros();
   }
 
   else {
     clockHighTime = micros() - previousClockHighTime;  // Tracks the clock high time to find the reset between commands
 
+    // Panel bit from the clock high that just ended, captured before the virtual keypad checks the bit counts
+    #if defined(dscEdgeCapture)
+    captureData(true, dataHigh);
+    #endif
+
     // Virtual keypad
     if (virtualKeypad) {
       static bool writeStart = false;
@@ -462,14 +719,14 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscClockInterrupt() {
         // Writes the first bit by shifting the alarm key data right 7 bits and checking bit 0
         if (isrPanelBitTotal == 1) {
           if (!((writeKey >> 7) & 0x01)) {
-            digitalWrite(dscWritePin, HIGH);
+            writePinHigh();
           }
           writeStart = true;  // Resolves a timing issue where some writes do not begin at the correct bit
         }
 
         // Writes the remaining alarm key data
         else if (writeStart && isrPanelBitTotal > 1 && isrPanelBitTotal <= 8) {
-          if (!((writeKey >> (8 - isrPanelBitTotal)) & 0x01)) digitalWrite(dscWritePin, HIGH);
+          if (!((writeKey >> (8 - isrPanelBitTotal)) & 0x01)) writePinHigh();
           // Resets counters when the write is complete
           if (isrPanelBitTotal == 8) {
             writeReady = true;
@@ -487,13 +744,13 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscClockInterrupt() {
       else if (!writeReady && !wroteAsterisk && isrPanelByteCount == writeByte && writeCmd) {
         // Writes the first bit by shifting the key data right 7 bits and checking bit 0
         if (isrPanelBitTotal == writeBit) {
-          if (!((writeKey >> 7) & 0x01)) digitalWrite(dscWritePin, HIGH);
+          if (!((writeKey >> 7) & 0x01)) writePinHigh();
           writeStart = true;  // Resolves a timing issue where some writes do not begin at the correct bit
         }
 
         // Writes the remaining alarm key data
         else if (writeStart && isrPanelBitTotal > writeBit && isrPanelBitTotal <= writeBit + 7) {
-          if (!((writeKey >> (7 - isrPanelBitCount)) & 0x01)) digitalWrite(dscWritePin, HIGH);
+          if (!((writeKey >> (7 - isrPanelBitCount)) & 0x01)) writePinHigh();
 
           // Resets counters when the write is complete
           if (isrPanelBitTotal == writeBit + 7) {
@@ -505,9 +762,15 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscClockInterrupt() {
       }
     }
   }
+
+  #if defined(dscTimingStats)
+  recordTiming(isrTiming.clockInterruptMin, isrTiming.clockInterruptMax, micros() - isrStartTime);
+  #endif
 }
 
 
+#if !defined(dscEdgeCapture)
+
 // Interrupt function called after 250us by dscClockInterrupt() using AVR Timer1, disables the timer and calls
 // dscDataInterrupt() to read the data line
 #if defined(__AVR__)
@@ -523,12 +786,47 @@ ISR(TIMER1_OVF_vect) {
 void dscKeybusInterface::dscDataInterrupt() {
 #elif defined(ESP8266)
 void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
+#endif
+
+  // Records the delay from the clock change to this sample in the histogram, bins are dscTimingBinWidth wide
+  // starting at 250us with later samples in the last bin
+  #if defined(dscTimingStats)
+  unsigned long isrStartTime = micros();
+  if (isrSamplePending) {
+    isrSamplePending = false;
+    unsigned long sampleDelay = isrStartTime - isrClockTime;
+    isrTiming.samples++;
+    if (sampleDelay > dscLateSample) isrTiming.lateSamples++;
+    recordTiming(isrTiming.sampleDelayMin, isrTiming.sampleDelayMax, sampleDelay);
+    unsigned long timingBin = 0;
+    if (sampleDelay > 250) timingBin = (sampleDelay - 250) / dscTimingBinWidth;
+    if (timingBin >= dscTimingBins) timingBin = dscTimingBins - 1;
+    isrTiming.sampleDelayBins[timingBin]++;
+  }
+  #endif
+
+  captureData(clockPinHigh(), readPinHigh());
+
+  #if defined(dscTimingStats)
+  recordTiming(isrTiming.dataInterruptMin, isrTiming.dataInterruptMax, micros() - isrStartTime);
+  #endif
+}
+
+#endif  // dscEdgeCapture
+
+
+// Stores a bit read from the data line while the clock was high (panel) or low (keypads and modules) and saves the
+// data to the buffers after each command - called by dscDataInterrupt(), or by dscClockInterrupt() for edge capture
+#if defined(__AVR__)
+void dscKeybusInterface::captureData(bool clockHigh, bool dataHigh) {
+#elif defined(ESP8266)
+void ICACHE_RAM_ATTR dscKeybusInterface::captureData(bool clockHigh, bool dataHigh) {
 #endif
 
   static bool skipData = false;
 
   // Panel sends data while the clock is high
-  if (digitalRead(dscClockPin) == HIGH) {
+  if (clockHigh) {
 
     // Stops processing Keybus data at the dscReadSize limit
     if (isrPanelByteCount >= dscReadSize) skipData = true;
@@ -537,7 +835,7 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
       if (isrPanelBitCount < 8) {
         // Data is captured in each byte by shifting left by 1 bit and writing to bit 0
         isrPanelData[isrPanelByteCount] <<= 1;
-        if (digitalRead(dscReadPin) == HIGH) {
+        if (dataHigh) {
           isrPanelData[isrPanelByteCount] |= 1;
         }
       }
@@ -552,6 +850,7 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
         }
 
         // Stores the stop bit by itself in byte 1 - this aligns the Keybus bytes with panelData[] bytes
+        checkPanelByte();
         isrPanelBitCount = 0;
         isrPanelByteCount++;
       }
@@ -563,6 +862,7 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
 
       // Byte is complete, set the counters for the next byte
       else {
+        checkPanelByte();
         isrPanelBitCount = 0;
         isrPanelByteCount++;
       }
@@ -575,13 +875,12 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
   else {
     static bool moduleDataDetected = false;
 
-    // Keypad and module data is not buffered and skipped if the panel data buffer is filling
-    if (processModuleData && isrModuleByteCount < dscReadSize && panelBufferLength <= 1) {
+    if (processModuleData && isrModuleByteCount < dscReadSize) {
 
       // Data is captured in each byte by shifting left by 1 bit and writing to bit 0
       if (isrModuleBitCount < 8) {
         isrModuleData[isrModuleByteCount] <<= 1;
-        if (digitalRead(dscReadPin) == HIGH) {
+        if (dataHigh) {
           isrModuleData[isrModuleByteCount] |= 1;
         }
         else moduleDataDetected = true;  // Keypads and modules send data by pulling the data line low
@@ -611,48 +910,69 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
     // Saves data and resets counters after the clock cycle is complete (high for at least 1ms)
     if (clockHighTime > 1000) {
       keybusTime = millis();
+      unsigned long isrPanelTime = micros();
 
-      // Skips incomplete and redundant data from status commands - these are sent constantly on the keybus at a high
-      // rate, so they are always skipped.  Checking is required in the ISR to prevent flooding the buffer.
+      // Skips incomplete and redundant data from status commands 0x05 (partitions 1-4) and 0x1B (partitions 5-8) -
+      // these are sent constantly on the keybus at a high rate, so they are always skipped.  Checking is required in
+      // the ISR to prevent flooding the buffer, the bytes are compared by checkPanelByte() as they are read.
       if (isrPanelBitTotal < 8) skipData = true;
-      else switch (isrPanelData[0]) {
-        static byte previousCmd05[dscReadSize];
-        static byte previousCmd1B[dscReadSize];
-        case 0x05:  // Status: partitions 1-4
-          if (redundantPanelData(previousCmd05, isrPanelData, isrPanelByteCount)) skipData = true;
-          break;
-
-        case 0x1B:  // Status: partitions 5-8
-          if (redundantPanelData(previousCmd1B, isrPanelData, isrPanelByteCount)) skipData = true;
-          break;
+      else if (isrPreviousCmd != NULL) {
+        if (isrRedundantData) skipData = true;
+        else for (byte i = 0; i < dscReadSize; i++) isrPreviousCmd[i] = isrPanelData[i];
       }
 
+      // Counts each command sent by the panel, used to pair keypad and module data with the panel command
+      isrPanelSequence++;
+
       // Stores new panel data in the panel buffer
-      currentCmd = isrPanelData[0];
-      if (panelBufferLength == dscBufferSize) bufferOverflow = true;
-      else if (!skipData && panelBufferLength < dscBufferSize) {
-        for (byte i = 0; i < dscReadSize; i++) panelBuffer[panelBufferLength][i] = isrPanelData[i];
-        panelBufferBitCount[panelBufferLength] = isrPanelBitTotal;
-        panelBufferByteCount[panelBufferLength] = isrPanelByteCount;
-        panelBufferLength++;
-      }
+      if (!skipData) {
+
+        // Counts the panel buffer bytes in use - handlePanel() may only decrease this by advancing the tail
+        dscBufferIndex bufferHead = panelBufferHead;
+        dscBufferIndex bufferTail = panelBufferTail;
+        dscBufferIndex bufferUsed;
+        if (bufferHead >= bufferTail) bufferUsed = bufferHead - bufferTail;
+        else bufferUsed = bufferHead + dscBufferBytes - bufferTail;
+
+        byte dataCount = isrPanelByteCount + 1;  // Includes the partial byte with any trailing bits
+        if (dataCount > dscReadSize) dataCount = dscReadSize;
+        if (bufferUsed + dataCount + 6 >= dscBufferBytes) bufferOverflow = true;
+        else {
+          panelBuffer[bufferHead] = isrPanelBitTotal | (isrPanelCRC ? 0x80 : 0);
+          if (++bufferHead == dscBufferBytes) bufferHead = 0;
+          panelBuffer[bufferHead] = isrPanelSequence;
+          if (++bufferHead == dscBufferBytes) bufferHead = 0;
+          for (byte i = 0; i < 4; i++) {
+            panelBuffer[bufferHead] = isrPanelTime >> (i * 8);
+            if (++bufferHead == dscBufferBytes) bufferHead = 0;
+          }
+          for (byte i = 0; i < dataCount; i++) {
+            panelBuffer[bufferHead] = isrPanelData[i];
+            if (++bufferHead == dscBufferBytes) bufferHead = 0;
+          }
 
-      // Resets the panel capture data and counters
-      for (byte i = 0; i < dscReadSize; i++) isrPanelData[i] = 0;
-      isrPanelBitTotal = 0;
-      isrPanelBitCount = 0;
-      isrPanelByteCount = 0;
-      skipData = false;
+          // Publishes the command to handlePanel() after the data has been stored
+          panelBufferHead = bufferHead;
+        }
+      }
 
       if (processModuleData) {
 
-        // Stores new keypad and module data - this data is not buffered
+        // Stores new keypad and module data in the module buffer with the panel command it was sent during
         if (moduleDataDetected) {
           moduleDataDetected = false;
-          moduleDataCaptured = true;  // Sets a flag for handleModules()
-          for (byte i = 0; i < dscReadSize; i++) moduleData[i] = isrModuleData[i];
-          moduleBitCount = isrModuleBitTotal;
-          moduleByteCount = isrModuleByteCount;
+          byte moduleHead = moduleBufferHead;
+          byte nextHead = moduleHead + 1;
+          if (nextHead == dscModuleBufferSize) nextHead = 0;
+          if (nextHead == moduleBufferTail) bufferOverflow = true;
+          else {
+            for (byte i = 0; i < dscReadSize; i++) moduleBuffer[moduleHead][i] = isrModuleData[i];
+            moduleBufferBitCount[moduleHead] = isrModuleBitTotal;
+            moduleBufferByteCount[moduleHead] = isrModuleByteCount;
+            moduleBufferCmd[moduleHead] = isrPanelData[0];
+            moduleBufferSequence[moduleHead] = isrPanelSequence;
+            moduleBufferHead = nextHead;  // Publishes the command to handleModule() after the data has been stored
+          }
         }
 
         // Resets the keypad and module capture data and counters
@@ -661,6 +981,42 @@ void ICACHE_RAM_ATTR dscKeybusInterface::dscDataInterrupt() {
         isrModuleBitCount = 0;
         isrModuleByteCount = 0;
       }
+
+      // Resets the panel capture data and counters
+      for (byte i = 0; i < dscReadSize; i++) isrPanelData[i] = 0;
+      isrPanelBitTotal = 0;
+      isrPanelBitCount = 0;
+      isrPanelByteCount = 0;
+      isrPanelSum = 0;
+      isrPanelCRC = false;
+      isrRedundantData = true;
+      isrPreviousCmd = NULL;
+      skipData = false;
+    }
+  }
+}
+
+
+// Updates the checksum and the redundant status command check as each panel byte is read, so the checks at the end
+// of the command take the same time regardless of length
+#if defined(__AVR__)
+void dscKeybusInterface::checkPanelByte() {
+#elif defined(ESP8266)
+void ICACHE_RAM_ATTR dscKeybusInterface::checkPanelByte() {
+#endif
+  byte panelByte = isrPanelData[isrPanelByteCount];
+
+  // The CRC is valid if the last complete byte is the sum of the previous bytes, excluding the stop bit in byte 1
+  isrPanelCRC = (isrPanelSum == panelByte);
+  if (isrPanelByteCount != 1) isrPanelSum += panelByte;
+
+  // Status commands are compared byte by byte to the previous status command
+  if (isrPanelByteCount == 0) {
+    switch (panelByte) {
+      case 0x05: isrPreviousCmd = isrPreviousCmd05; break;
+      case 0x1B: isrPreviousCmd = isrPreviousCmd1B; break;
+      default: isrPreviousCmd = NULL; break;
     }
   }
+  if (isrPreviousCmd != NULL && isrPreviousCmd[isrPanelByteCount] != panelByte) isrRedundantData = false;
 }
@@ -19,20 +19,231 @@
 #define dscKeybusInterface_h
 
 #include <Arduino.h>
+#include "dscKeybusDecode.h"
 
 
+// The number of partitions, zone groups and buffered commands can be set at build time to reduce memory usage or
+// to buffer more commands for a busy sketch, for example with PlatformIO:
+//   build_flags = -D dscConfigPartitions=2 -D dscConfigZones=2 -D dscConfigBufferSize=80
+// These must be set for both the sketch and the library, so they cannot be set with #define in the sketch.
 #if defined(__AVR__)
-const byte dscPartitions = 4;   // Maximum number of partitions - requires 19 bytes of memory per partition
-const byte dscZones = 4;        // Maximum number of zone groups, 8 zones per group - requires 6 bytes of memory per zone group
-const byte dscBufferSize = 10;  // Number of commands to buffer if the sketch is busy - requires dscReadSize + 2 bytes of memory per command
+#ifndef dscConfigPartitions
+#define dscConfigPartitions 4        // Maximum number of partitions - requires 7 bytes of memory per partition: 6 for dscPartition, 1 for partitionChanged[]
+#endif
+#ifndef dscConfigZones
+#define dscConfigZones 4             // Maximum number of zone groups, 8 zones per group - up to 4 groups on Arduino with zone status stored in 32-bit words
+#endif
+#ifndef dscConfigBufferSize
+#define dscConfigBufferSize 8        // Number of full-length commands to buffer if the sketch is busy, up to 11 on Arduino - requires dscReadSize + 6 bytes of memory per command, 177 bytes for 8 (about 10 typical commands)
+#endif
+#ifndef dscConfigModuleBufferSize
+#define dscConfigModuleBufferSize 4  // Number of keypad and module commands to buffer if processModuleData is enabled, 1 is unused - requires dscReadSize + 4 bytes of memory per command
+#endif
 #elif defined(ESP8266)
-const byte dscPartitions = 8;
-const byte dscZones = 8;
-const byte dscBufferSize = 50;
+#ifndef dscConfigPartitions
+#define dscConfigPartitions 8
+#endif
+#ifndef dscConfigZones
+#define dscConfigZones 8
+#endif
+#ifndef dscConfigBufferSize
+#define dscConfigBufferSize 50
+#endif
+#ifndef dscConfigModuleBufferSize
+#define dscConfigModuleBufferSize 20
+#endif
+#endif
+#ifndef dscConfigEventBufferSize
+#if defined(__AVR__)
+#define dscConfigEventBufferSize 16  // Number of status events to queue if dscEvents is enabled, 1 is unused - requires 10 bytes of memory per event
+#else
+#define dscConfigEventBufferSize 80
+#endif
 #endif
 
+const byte dscPartitions = dscConfigPartitions;
+const byte dscZones = dscConfigZones;
+const byte dscBufferSize = dscConfigBufferSize;
+const byte dscModuleBufferSize = dscConfigModuleBufferSize;
+const byte dscEventBufferSize = dscConfigEventBufferSize;
+
 const byte dscReadSize = 16;   // Maximum size of a Keybus command
 
+// Partition status change flags set in partitionChanged[]
+const byte dscReadyChanged = 0x01;
+const byte dscArmedChanged = 0x02;
+const byte dscAlarmChanged = 0x04;
+const byte dscExitDelayChanged = 0x08;
+const byte dscEntryDelayChanged = 0x10;
+const byte dscFireChanged = 0x20;
+
+// Returns the position of the lowest set bit to find the next change in partitionsChanged or partitionChanged[],
+// the value must be nonzero
+inline byte dscLowestBit(byte value) {
+  return __builtin_ctz(value);
+}
+
+// Zone status is stored in a single word using 1 bit per zone: Bit 0 = Zone 1 ... Bit 63 = Zone 64.  Arduino uses
+// a 32-bit word for its 4 zone groups to keep zone processing to native 8-bit operations where possible.
+#if defined(__AVR__)
+typedef uint32_t dscZoneWord;
+#else
+typedef uint64_t dscZoneWord;
+#endif
+
+// Returns the bit for a zone in openZones, alarmZones, etc, zoneIndex 0 = Zone 1 ... 63 = Zone 64
+inline dscZoneWord dscZoneBit(byte zoneIndex) {
+  return (dscZoneWord)1 << zoneIndex;
+}
+
+// Returns the index of the next zone set in a zone word and clears it to iterate through changed zones, the
+// value must be nonzero: 0 = Zone 1 ... 63 = Zone 64
+inline byte dscNextZone(dscZoneWord &zones) {
+  #if defined(__AVR__)
+  byte zoneIndex = __builtin_ctzl(zones);
+  #else
+  byte zoneIndex = __builtin_ctzll(zones);
+  #endif
+  zones &= zones - 1;
+  return zoneIndex;
+}
+
+// Returns the number of zones set in a zone word, for example the number of open zones
+inline byte dscZoneCount(dscZoneWord zones) {
+  #if defined(__AVR__)
+  return __builtin_popcountl(zones);
+  #else
+  return __builtin_popcountll(zones);
+  #endif
+}
+
+// Returns the text of a partition status message (dscPartition::status) stored in flash, for example to print with
+// Serial.print() - the short message fits a 16 character keypad display.  Returns NULL if the status is not
+// recognized.
+const __FlashStringHelper *dscStatusMessage(byte status, bool shortMessage = false);
+
+// Copies the text of a partition status message to a buffer with a terminating null, returns the length copied or
+// 0 if the status is not recognized
+byte dscCopyStatusMessage(byte status, char buffer[], byte bufferSize, bool shortMessage = false);
+
+// Partition status is packed with 1 bit per status so that each dscPartition uses 6 bytes: the status lights and
+// message, the current status, and the previous status used internally to detect changes.  The status change flags
+// in partitionChanged[] are the 7th byte per partition.
+class dscPartition {
+  public:
+    byte lights;              // Status lights: bit 0 = Ready, bit 1 = Armed, ... bit 7 = Backlight - see printPanelLights()
+    byte status;              // Status message, see dscStatusMessage()
+    bool ready : 1;
+    bool armed : 1;
+    bool armedAway : 1;
+    bool armedStay : 1;
+    bool noEntryDelay : 1;
+    bool alarm : 1;
+    bool exitDelay : 1;
+    bool entryDelay : 1;
+    bool fire : 1;
+
+  private:
+    friend class dscKeybusInterface;
+    bool previousReady : 1;
+    bool previousArmed : 1;
+    bool previousAlarm : 1;
+    bool previousExitDelay : 1;
+    bool previousEntryDelay : 1;
+    bool previousFire : 1;
+    bool writeArm : 1;
+    byte previousLights, previousStatus;
+};
+
+// Buffered commands are packed as a 6 byte header (bit count with the CRC result, sequence number, and capture
+// time) followed by only the bytes read, so typical commands use 12-17 bytes and more than dscBufferSize commands
+// fit in the buffer.  The buffer holds dscBufferSize full-length commands of dscReadSize + 6 bytes, plus 1 byte
+// that is left unused so that a full buffer is not read as empty.  Indices into the buffer are shared by
+// dscDataInterrupt() and handlePanel() and are sized to be read atomically: 1 byte on AVR, 4 bytes on esp8266.
+const unsigned int dscBufferBytes = dscBufferSize * (dscReadSize + 6) + 1;
+#if defined(__AVR__)
+typedef byte dscBufferIndex;
+#else
+typedef unsigned int dscBufferIndex;
+#endif
+
+// Uncomment to read the data line on each clock change instead of 250us later with a timer: this halves the number
+// of interrupts and leaves Arduino Timer1 or esp8266 timer1 free for the sketch.  There is no latency compensation:
+// the panel drives its next bit ~20us after the clock rises, so the clock interrupt must start within ~20us or the
+// panel's bit is recorded as the keypad/module bit.  esp8266 interrupt latency can exceed this while WiFi is active
+// or flash is being accessed, so edge capture is best suited to Arduino or esp8266 sketches without WiFi.
+//#define dscEdgeCapture
+
+// Uncomment to record interrupt timing statistics, read in the sketch with getTiming() - this adds a few us to each
+// interrupt for the calls to micros()
+//#define dscTimingStats
+
+#if defined(dscTimingStats)
+const byte dscTimingBins = 8;           // Number of sample delay histogram bins
+const byte dscTimingBinWidth = 50;      // Histogram bin width in us, starting at the 250us sample delay
+const unsigned int dscLateSample = 400; // Sample delay in us considered late - the clock changes every ~500us
+
+// Interrupt timing statistics in us since the last resetTiming() - with dscEdgeCapture there is no data interrupt
+// and only the dscClockInterrupt() timing is recorded
+struct dscTimingData {
+  unsigned long samples;                // Data line samples by dscDataInterrupt()
+  unsigned long lateSamples;            // Samples delayed more than dscLateSample after the clock changed
+  unsigned long missedSamples;          // Clock changes before the previous sample was read - the bit is lost
+  unsigned int sampleDelayMin, sampleDelayMax;  // Time from the clock change to the data sample
+  unsigned int clockInterruptMin, clockInterruptMax;  // Time spent in dscClockInterrupt()
+  unsigned int dataInterruptMin, dataInterruptMax;    // Time spent in dscDataInterrupt()
+  unsigned long sampleDelayBins[dscTimingBins];       // Sample delay histogram: 250-299us, 300-349us, ...
+};
+#endif
+
+// Status changes are sent as events to the callbacks set with onZoneChange(), onPartitionChange(), etc, as each
+// change is decoded.  Uncomment to also queue the events, read in the sketch with getEvent() - events are queued in
+// the order the changes are decoded, so a burst of zone changes is read one zone at a time and not collapsed into flags
+//#define dscEvents
+
+// Event types, with the partition or zone number and the new status in dscEvent - partition event types 1-6 match
+// the partitionChanged[] flags: dscReadyChanged = 1 << (dscEventReady - 1), etc
+const byte dscEventReady = 1;          // Partition ready: 1 = ready, 0 = not ready
+const byte dscEventArmed = 2;          // Partition armed: dscArmedStay, dscArmedAway, 0 = disarmed
+const byte dscEventAlarm = 3;          // Partition alarm: 1 = alarm triggered, 0 = alarm cleared
+const byte dscEventExitDelay = 4;      // Partition exit delay: 1 = in progress, 0 = ended
+const byte dscEventEntryDelay = 5;     // Partition entry delay: 1 = in progress, 0 = ended
+const byte dscEventFire = 6;           // Partition fire alarm: 1 = fire alarm, 0 = fire alarm restored
+const byte dscEventZoneOpen = 7;       // Zone open: 1 = open, 0 = closed
+const byte dscEventZoneAlarm = 8;      // Zone alarm: 1 = alarm, 0 = alarm restored
+const byte dscEventTrouble = 9;        // Panel trouble: 1 = trouble, 0 = restored
+const byte dscEventPowerTrouble = 10;  // Panel AC power: 1 = AC power failure, 0 = restored
+const byte dscEventBatteryTrouble = 11;  // Panel battery: 1 = battery trouble, 0 = restored
+const byte dscEventKeybus = 12;        // Keybus: 1 = connected, 0 = disconnected
+const byte dscEventKeypadAlarm = 13;   // Keypad alarm keys: 'F' = fire, 'A' = aux, 'P' = panic
+const byte dscEventAccessCode = 14;    // Panel is requesting an access code for the partition
+
+const byte dscArmedStay = 1;
+const byte dscArmedAway = 2;
+
+struct dscEvent {
+  byte type;             // dscEventReady, dscEventZoneOpen, etc
+  byte number;           // Partition 1-8 or zone 1-64, 0 for panel and Keybus events
+  byte value;            // The new status, see the event types
+  byte sequence;         // Keybus sequence number of the panel command with the change
+  unsigned long time;    // Capture time in micros() of the panel command with the change
+  byte hour, minute;     // Panel time of the change, 255 before the panel has sent the time
+};
+
+// A panel command saved with getPanelRecord() in place of printing it immediately, for example to keep printing
+// out of the loop that handles the Keybus.  The record can be printed later with the printPanel*() functions that
+// take a record, or sent to another device and printed there with the library.
+struct dscPanelRecord {
+  byte data[dscReadSize];  // Command [0], stop bit [1], and remaining data as in panelData[]
+  byte bitCount;
+  bool crc;
+  byte sequence;
+  unsigned long time;      // Capture time in micros()
+};
+
+// Event callbacks are called from handlePanel() while the panel command is decoded, so other status from the same
+// command may not be updated yet
+typedef void (*dscEventCallback)(const dscEvent &event);
 
 class dscKeybusInterface {
 
@@ -43,6 +254,7 @@ class dscKeybusInterface {
 
     void begin(Stream &_stream = Serial);             // Initializes the stream output to Serial by default
     bool handlePanel();                               // Returns true if valid panel data is available
+    byte handlePanelBatch(byte maxCommands = 255, unsigned long maxMicros = 2000);  // Processes buffered panel data up to the limits, returns the number of valid commands
     bool handleModule();                              // Returns true if valid keypad or module data is available
     static volatile bool writeReady;                  // True if the library is ready to write a key
     void write(const char receivedKey);               // Writes a single key
@@ -52,6 +264,16 @@ class dscKeybusInterface {
     void printPanelMessage();                         // Prints the decoded panel message
     void printModuleBinary(bool printSpaces = true);  // Includes spaces between bytes by default
     void printModuleMessage();                        // Prints the decoded keypad or module message
+    void printPanelCapture();                         // Writes the panel command as a binary capture frame
+    void printModuleCapture();                        // Writes the keypad or module data as a binary capture frame
+    void printOverflowCapture();                      // Writes a buffer overflow marker as a binary capture frame
+    byte loadCapture(const byte frame[], byte frameLength);  // Loads a decoded capture frame for the print functions, returns 'P', 'M', 'O', or 0 if invalid
+
+    // Saves the command in panelData[] to a record without printing, and prints a saved record
+    void getPanelRecord(dscPanelRecord &record);
+    void printPanelBinary(const dscPanelRecord &record, bool printSpaces = true);
+    void printPanelCommand(const dscPanelRecord &record);
+    void printPanelMessage(const dscPanelRecord &record);
 
     // Set to a partition number for virtual keypad
     static byte writePartition;
@@ -67,11 +289,11 @@ class dscKeybusInterface {
     byte hour, minute, day, month;
     int year;
 
-    // These contain the current LED state and status message for each partition based on command 0x05 for
-    // partitions 1-4 and command 0x1B for partitions 5-8.  See printPanelLights() and printPanelMessages()
-    // in dscKeybusPrintData.cpp to see how this data translates to the LED status and status message.
-    byte status[dscPartitions];
-    byte lights[dscPartitions];
+    // Partition status: partitions[0] = Partition 1 ... partitions[7] = Partition 8.  The lights and status message
+    // are based on command 0x05 for partitions 1-4 and command 0x1B for partitions 5-8.  See printPanelLights() and
+    // printPanelMessages() in dscKeybusPrintData.cpp to see how this data translates to the LED status and status
+    // message.
+    dscPartition partitions[dscPartitions];
 
     // Status tracking
     bool statusChanged;                   // True after any status change
@@ -81,17 +303,19 @@ class dscKeybusInterface {
     bool powerTrouble, powerChanged;
     bool batteryTrouble, batteryChanged;
     bool keypadFireAlarm, keypadAuxAlarm, keypadPanicAlarm;
-    bool ready[dscPartitions], readyChanged[dscPartitions];
-    bool armed[dscPartitions], armedAway[dscPartitions], armedStay[dscPartitions];
-    bool noEntryDelay[dscPartitions], armedChanged[dscPartitions];
-    bool alarm[dscPartitions], alarmChanged[dscPartitions];
-    bool exitDelay[dscPartitions], exitDelayChanged[dscPartitions];
-    bool entryDelay[dscPartitions], entryDelayChanged[dscPartitions];
-    bool fire[dscPartitions], fireChanged[dscPartitions];
+
+    // Partition status changes are stored using 1 bit per status in partitionChanged[] (dscReadyChanged,
+    // dscArmedChanged, etc), and 1 bit per partition with any changes in partitionsChanged: Bit 0 = Partition 1 ...
+    // Bit 7 = Partition 8.  These are reset by the sketch after the changes are processed.
+    byte partitionChanged[dscPartitions];
+    byte partitionsChanged;
+
+    // Zone status is stored using 1 bit per zone, up to 64 zones: Bit 0 = Zone 1 ... Bit 63 = Zone 64.  Changed
+    // zones can be iterated with dscNextZone(), which also resets each zone in the changed word.
     bool openZonesStatusChanged;
-    byte openZones[dscZones], openZonesChanged[dscZones];    // Zone status is stored in an array using 1 bit per zone, up to 64 zones
+    dscZoneWord openZones, openZonesChanged;
     bool alarmZonesStatusChanged;
-    byte alarmZones[dscZones], alarmZonesChanged[dscZones];  // Zone alarm status is stored in an array using 1 bit per zone, up to 64 zones
+    dscZoneWord alarmZones, alarmZonesChanged;
 
     // Panel and keypad data is stored in an array: command [0], stop bit by itself [1], followed by the remaining
     // data.  panelData[] and moduleData[] can be accessed directly within the sketch.
@@ -101,31 +325,55 @@ class dscKeybusInterface {
     //   00000101 0 10000001 00000001 10010001 11000111 [0x05] Status lights: Ready Backlight | Partition ready
     //            ^ Byte 1 (stop bit)
     static byte panelData[dscReadSize];
-    static volatile byte moduleData[dscReadSize];
+    static byte moduleData[dscReadSize];
 
-    // True if dscBufferSize needs to be increased
+    // Capture time in micros() and Keybus sequence number of the command in panelData[], set by handlePanel() - for
+    // example, micros() - panelTime is the time the command waited in the buffer
+    static unsigned long panelTime;
+    static byte panelSequence;
+
+    // The panel command and its Keybus sequence number (incremented for each command sent by the panel) during
+    // which moduleData[] was sent - for example, moduleCmd 0x11 for a keypad slot query response
+    static byte moduleCmd, moduleSequence;
+
+    // True if dscBufferSize or dscModuleBufferSize needs to be increased
     static volatile bool bufferOverflow;
 
+    // Sets a function to call for each status change, filtered by zone (Bit 0 = Zone 1 ... Bit 63 = Zone 64),
+    // partition (Bit 0 = Partition 1 ... Bit 7 = Partition 8), and partition status (dscReadyChanged,
+    // dscArmedChanged, etc).  Trouble callbacks include trouble, AC power, battery, Keybus, and keypad alarm events.
+    void onZoneChange(dscEventCallback callback, dscZoneWord zones = ~(dscZoneWord)0);
+    void onZoneAlarm(dscEventCallback callback, dscZoneWord zones = ~(dscZoneWord)0);
+    void onPartitionChange(dscEventCallback callback, byte partitions = 0xFF, byte changes = 0xFF);
+    void onTrouble(dscEventCallback callback);
+
+    #if defined(dscEvents)
+    bool getEvent(dscEvent &event);         // Copies and removes the oldest event, returns false if no events are queued
+    byte eventsDropped;                     // Number of events dropped because the queue was full, reset by the sketch
+    #endif
+
+    #if defined(dscTimingStats)
+    void getTiming(dscTimingData &timing);  // Copies the interrupt timing statistics
+    void resetTiming();                     // Clears the interrupt timing statistics
+    #endif
+
     // Timer interrupt function to capture data - declared as public for use by AVR Timer2
+    #if !defined(dscEdgeCapture)
     static void dscDataInterrupt();
+    #endif
 
   private:
 
-    void processPanelStatus();
-    void processPanelStatus0(byte partition, byte panelByte);
-    void processPanelStatus2(byte partition, byte panelByte);
-    void processPanelStatus4(byte partition, byte panelByte);
-    void processPanel_0x27();
-    void processPanel_0x2D();
-    void processPanel_0x34();
-    void processPanel_0x3E();
-    void processPanel_0xA5();
-    void processPanel_0xE6();
-    void processPanel_0xE6_0x09();
-    void processPanel_0xE6_0x0B();
-    void processPanel_0xE6_0x0D();
-    void processPanel_0xE6_0x0F();
-    void processPanel_0xEB();
+    void processPanelStatus(const dscPanelStatus &panelStatus);
+    void processPanelArmed(const dscPanelStatus &panelStatus);
+    void processPanelMessage(const dscPanelMessage &message);
+    void processPanelStatus0(const dscPanelMessage &message);
+    void processPanelStatus2(const dscPanelMessage &message);
+    void processPanelStatus4(const dscPanelMessage &message);
+    void processStatusChange(bool currentStatus, byte partitionIndex, byte changedFlag);
+    void setPartitionChanged(byte partitionIndex, byte changedFlag);
+    void processAlarmZone(byte zoneIndex, byte zoneAlarm);
+    void processOpenZones(byte zoneGroup, byte zoneStatus);
 
     void printPanelLights(byte panelByte);
     void printPanelMessages(byte panelByte);
@@ -193,40 +441,122 @@ class dscKeybusInterface {
 
     bool validCRC();
     void writeKeys(const char * writeKeysArray);
+    void setPanelRecord(const dscPanelRecord &record);
+    void printCaptureFrame(byte frame[], byte frameLength);
     static void dscClockInterrupt();
+    static void captureData(bool clockHigh, bool dataHigh);
+    static void checkPanelByte();
     static bool redundantPanelData(byte previousCmd[], volatile byte currentCmd[], byte checkedBytes = dscReadSize);
 
     Stream* stream;
     const char* writeKeysArray;
     bool writeKeysPending;
-    bool writeArm[dscPartitions];
     bool queryResponse;
     bool previousTrouble;
     bool previousKeybus;
-    byte previousLights[dscPartitions], previousStatus[dscPartitions];
-    bool previousReady[dscPartitions];
-    bool previousExitDelay[dscPartitions], previousEntryDelay[dscPartitions];
-    bool previousArmed[dscPartitions], previousAlarm[dscPartitions];
-    bool previousFire[dscPartitions];
-    byte previousOpenZones[dscZones], previousAlarmZones[dscZones];
+    dscZoneWord previousOpenZones, previousAlarmZones;
+
+    // Status change callbacks and filters
+    dscEventCallback zoneCallback, zoneAlarmCallback, partitionCallback, troubleCallback;
+    dscZoneWord zoneCallbackZones, zoneAlarmCallbackZones;
+    byte partitionCallbackPartitions, partitionCallbackChanges;
+    void processEvent(byte type, byte number, byte value);
+    void processEvent(byte type, byte number, byte value, unsigned long eventTime);
+    void processZoneEvents(byte type, dscZoneWord zonesChanged, dscZoneWord zones);
+
+    // Event queue: changes are queued at eventHead and getEvent() reads at eventTail, both from the sketch
+    #if defined(dscEvents)
+    dscEvent events[dscEventBufferSize];
+    byte eventHead, eventTail;
+    #endif
 
     static byte dscClockPin;
     static byte dscReadPin;
     static byte dscWritePin;
+
+    // Port registers and bit masks for direct access to the Keybus pins in the interrupts, set in begin()
+    #if defined(__AVR__)
+    static volatile uint8_t *clockPinRegister, *readPinRegister, *writePinRegister;
+    static uint8_t clockPinMask, readPinMask, writePinMask;
+    #elif defined(ESP8266)
+    static uint32_t clockPinMask, readPinMask, writePinMask;
+    #endif
+
     static byte writeByte, writeBit;
     static bool virtualKeypad;
     static char writeKey;
     static byte panelBitCount, panelByteCount;
+    static bool panelCRC;
     static volatile bool writeAlarm, writeAsterisk, wroteAsterisk;
-    static volatile bool moduleDataCaptured;
     static volatile unsigned long clockHighTime, keybusTime;
-    static volatile byte panelBufferLength;
-    static volatile byte panelBuffer[dscBufferSize][dscReadSize];
-    static volatile byte panelBufferBitCount[dscBufferSize], panelBufferByteCount[dscBufferSize];
-    static volatile byte moduleBitCount, moduleByteCount;
-    static volatile byte currentCmd, statusCmd;
+
+    // Panel data buffer: dscDataInterrupt() writes at panelBufferHead and handlePanel() reads at panelBufferTail,
+    // one byte is left unused so that a full buffer can be distinguished from an empty one without a length shared
+    // between the interrupt and the sketch.
+    static volatile dscBufferIndex panelBufferHead, panelBufferTail;
+    static volatile byte panelBuffer[dscBufferBytes];
+    static byte moduleBitCount, moduleByteCount;
+    static volatile byte statusCmd;
+    static byte isrPanelSequence;
+
+    // Running checksum and redundant status command check, updated by checkPanelByte() as each panel byte is read
+    static byte isrPanelSum;
+    static bool isrPanelCRC, isrRedundantData;
+    static byte *isrPreviousCmd;
+    static byte isrPreviousCmd05[dscReadSize], isrPreviousCmd1B[dscReadSize];
+
+    // Keypad and module data buffer: dscDataInterrupt() writes at moduleBufferHead and handleModule() reads at
+    // moduleBufferTail, each command is tagged with the panel command and sequence number it was sent during.
+    static volatile byte moduleBufferHead, moduleBufferTail;
+    static volatile byte moduleBuffer[dscModuleBufferSize][dscReadSize];
+    static volatile byte moduleBufferBitCount[dscModuleBufferSize], moduleBufferByteCount[dscModuleBufferSize];
+    static volatile byte moduleBufferCmd[dscModuleBufferSize], moduleBufferSequence[dscModuleBufferSize];
     static volatile byte isrPanelData[dscReadSize], isrPanelBitTotal, isrPanelBitCount, isrPanelByteCount;
     static volatile byte isrModuleData[dscReadSize], isrModuleBitTotal, isrModuleBitCount, isrModuleByteCount;
+
+    #if defined(dscTimingStats)
+    static volatile dscTimingData isrTiming;
+    static volatile bool isrSamplePending;
+    static volatile unsigned long isrClockTime;
+    static void recordTiming(volatile unsigned int &timingMin, volatile unsigned int &timingMax, unsigned long duration);
+    #endif
+};
+
+
+// Buffers printed output in memory and writes it to another stream in large writes, limited to a byte rate and to
+// the space the output reports with availableForWrite() so that printing never waits on a full serial port.  Outputs
+// that do not implement availableForWrite() always report 0 and need rateOnly, which writes limited by the byte rate
+// alone.  Output is handled as lines: a line that does not fit in the buffer is dropped as a whole and counted.  Set
+// as the library output with begin() and call update() from loop() to write the buffer:
+//   byte outputBuffer[1024];
+//   dscBufferedStream output(Serial, outputBuffer, sizeof(outputBuffer), 11520);  // 115200 baud
+//   dsc.begin(output);
+class dscBufferedStream : public Stream {
+  public:
+    dscBufferedStream(Stream &_output, byte *_buffer, unsigned int _bufferSize, unsigned long _bytesPerSecond = 0, bool _rateOnly = false);  // 0 bytes per second is unlimited
+    void update();                  // Writes buffered data up to the byte rate and available output space
+    void flush();                   // Writes all buffered data, waiting for the output
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *data, size_t size);
+    using Print::write;
+    int availableForWrite();
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+
+    unsigned long droppedBytes, droppedLines;  // Output lost while the buffer is full, reset by the sketch
+
+  private:
+    Stream* output;
+    byte* buffer;
+    unsigned int bufferSize, bufferHead, bufferTail, lineStart;
+    bool lineDropped;
+    unsigned long bytesPerSecond;
+    bool rateOnly;         // Ignores availableForWrite() for outputs that do not implement it
+    unsigned long budget;  // Bytes that can be written, in thousandths of a byte
+    static const unsigned int burstBytes = 64;  // Limit of the budget accumulated while idle, about one line
+    unsigned long budgetTime;
+    unsigned int bufferCount();
 };
 
 #endif  // dscKeybusInterface_h
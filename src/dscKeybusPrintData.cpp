@@ -77,7 +77,7 @@ void dscKeybusInterface::printModuleMessage() {
   }
 
   // Keypad and module responses to panel queries
-  switch (currentCmd) {
+  switch (moduleCmd) {
     case 0x11: printModule_Panel_0x11(); return;  // Keypad slot query response
     case 0xD5: printModule_Panel_0xD5(); return;  // Keypad zone query response
   }
@@ -114,82 +114,220 @@ void dscKeybusInterface::printModuleMessage() {
  }
 
 
+// Text for each partition status message, shared by printPanelMessages() and sketches through dscStatusMessage()
+// and dscCopyStatusMessage().  Each status has a full message and a short message that fits a 16 character keypad
+// display.  statusMessageIndex[] maps a status to its entry in the tables + 1, or 0 if the status is not
+// recognized, so a lookup is a single read from each table.  The tables and strings are stored in flash.
+static const char statusMessage01[] PROGMEM = "Partition ready";
+static const char statusMessage02[] PROGMEM = "Stay/away zones open";
+static const char statusMessage03[] PROGMEM = "Zones open";
+static const char statusMessage04[] PROGMEM = "Armed stay";
+static const char statusMessage05[] PROGMEM = "Armed away";
+static const char statusMessage07[] PROGMEM = "Failed to arm";
+static const char statusMessage08[] PROGMEM = "Exit delay in progress";
+static const char statusMessage09[] PROGMEM = "Arming with no entry delay";
+static const char statusMessage0B[] PROGMEM = "Quick exit in progress";
+static const char statusMessage0C[] PROGMEM = "Entry delay in progress";
+static const char statusMessage0D[] PROGMEM = "Opening after alarm";
+static const char statusMessage10[] PROGMEM = "Keypad lockout";
+static const char statusMessage11[] PROGMEM = "Partition in alarm";
+static const char statusMessage14[] PROGMEM = "Auto-arm in progress";
+static const char statusMessage15[] PROGMEM = "Arming with bypassed zones";
+static const char statusMessage16[] PROGMEM = "Armed with no entry delay";
+static const char statusMessage22[] PROGMEM = "Recent closing";
+static const char statusMessage33[] PROGMEM = "Command output in progress";
+static const char statusMessage3D[] PROGMEM = "Disarmed after alarm in memory";
+static const char statusMessage3E[] PROGMEM = "Partition disarmed";
+static const char statusMessage40[] PROGMEM = "Keypad blanked";
+static const char statusMessage8A[] PROGMEM = "Activate stay/away zones";
+static const char statusMessage8B[] PROGMEM = "Quick exit";
+static const char statusMessage8E[] PROGMEM = "Invalid option";
+static const char statusMessage8F[] PROGMEM = "Invalid access code";
+static const char statusMessage9E[] PROGMEM = "Enter * function code";
+static const char statusMessage9F[] PROGMEM = "Enter access code";
+static const char statusMessageA0[] PROGMEM = "*1: Zone bypass programming";
+static const char statusMessageA1[] PROGMEM = "*2: Trouble menu";
+static const char statusMessageA2[] PROGMEM = "*3: Alarm memory display";
+static const char statusMessageA3[] PROGMEM = "Door chime enabled";
+static const char statusMessageA4[] PROGMEM = "Door chime disabled";
+static const char statusMessageA5[] PROGMEM = "Enter master code";
+static const char statusMessageA6[] PROGMEM = "*5: Access codes";
+static const char statusMessageA7[] PROGMEM = "*5: Enter new code";
+static const char statusMessageA9[] PROGMEM = "*6: User functions";
+static const char statusMessageAA[] PROGMEM = "*6: Time and Date";
+static const char statusMessageAB[] PROGMEM = "*6: Auto-arm time";
+static const char statusMessageAC[] PROGMEM = "*6: Auto-arm enabled";
+static const char statusMessageAD[] PROGMEM = "*6: Auto-arm disabled";
+static const char statusMessageAF[] PROGMEM = "*6: System test";
+static const char statusMessageB0[] PROGMEM = "*6: Enable DLS";
+static const char statusMessageB2[] PROGMEM = "*7: Command output";
+static const char statusMessageB7[] PROGMEM = "Enter installer code";
+static const char statusMessageB8[] PROGMEM = "*  pressed while armed";
+static const char statusMessageB9[] PROGMEM = "*2: Zone tamper menu";
+static const char statusMessageBA[] PROGMEM = "*2: Zones with low batteries";
+static const char statusMessageC6[] PROGMEM = "*2: Zone fault menu";
+static const char statusMessageC8[] PROGMEM = "*2: Service required menu";
+static const char statusMessageD0[] PROGMEM = "*2: Handheld keypads with low batteries";
+static const char statusMessageD1[] PROGMEM = "*2: Wireless keys with low batteries";
+static const char statusMessageE4[] PROGMEM = "*8: Main menu";
+static const char statusMessageE5[] PROGMEM = "Keypad slot assignment";
+static const char statusMessageE6[] PROGMEM = "*8: Input required: 2 digits";
+static const char statusMessageE7[] PROGMEM = "*8: Input required: 3 digits";
+static const char statusMessageE8[] PROGMEM = "*8: Input required: 4 digits";
+static const char statusMessageEA[] PROGMEM = "*8: Reporting code: 2 digits";
+static const char statusMessageEB[] PROGMEM = "*8: Telephone number account code: 4 digits";
+static const char statusMessageEC[] PROGMEM = "*8: Input required: 6 digits";
+static const char statusMessageED[] PROGMEM = "*8: Input required: 32 digits";
+static const char statusMessageEE[] PROGMEM = "*8: Input required: 1 option per zone";
+static const char statusMessageF0[] PROGMEM = "Function key 1 programming";
+static const char statusMessageF1[] PROGMEM = "Function key 2 programming";
+static const char statusMessageF2[] PROGMEM = "Function key 3 programming";
+static const char statusMessageF3[] PROGMEM = "Function key 4 programming";
+static const char statusMessageF4[] PROGMEM = "Function key 5 programming";
+static const char statusMessageF8[] PROGMEM = "Keypad programming";
+
+static const char statusShortMessage01[] PROGMEM = "Ready";
+static const char statusShortMessage02[] PROGMEM = "Stay zones open";
+static const char statusShortMessage03[] PROGMEM = "Zones open";
+static const char statusShortMessage04[] PROGMEM = "Armed stay";
+static const char statusShortMessage05[] PROGMEM = "Armed away";
+static const char statusShortMessage07[] PROGMEM = "Failed to arm";
+static const char statusShortMessage08[] PROGMEM = "Exit delay";
+static const char statusShortMessage09[] PROGMEM = "No entry delay";
+static const char statusShortMessage0B[] PROGMEM = "Quick exit";
+static const char statusShortMessage0C[] PROGMEM = "Entry delay";
+static const char statusShortMessage0D[] PROGMEM = "Alarm memory";
+static const char statusShortMessage10[] PROGMEM = "Keypad lockout";
+static const char statusShortMessage11[] PROGMEM = "Alarm";
+static const char statusShortMessage14[] PROGMEM = "Auto-arm";
+static const char statusShortMessage15[] PROGMEM = "Arming bypass";
+static const char statusShortMessage33[] PROGMEM = "Busy";
+static const char statusShortMessage3D[] PROGMEM = "Disarmed";
+static const char statusShortMessage40[] PROGMEM = "Keypad blanked";
+static const char statusShortMessage8A[] PROGMEM = "Activate zones";
+static const char statusShortMessage8E[] PROGMEM = "Invalid option";
+static const char statusShortMessage8F[] PROGMEM = "Invalid code";
+static const char statusShortMessage9E[] PROGMEM = "Enter * code";
+static const char statusShortMessage9F[] PROGMEM = "Access code";
+static const char statusShortMessageA0[] PROGMEM = "Zone bypass";
+static const char statusShortMessageA1[] PROGMEM = "Trouble menu";
+static const char statusShortMessageA3[] PROGMEM = "Door chime on";
+static const char statusShortMessageA4[] PROGMEM = "Door chime off";
+static const char statusShortMessageA5[] PROGMEM = "Master code";
+static const char statusShortMessageA6[] PROGMEM = "Access codes";
+static const char statusShortMessageA7[] PROGMEM = "Enter new code";
+static const char statusShortMessageA9[] PROGMEM = "User function";
+static const char statusShortMessageAA[] PROGMEM = "Time and Date";
+static const char statusShortMessageAB[] PROGMEM = "Auto-arm time";
+static const char statusShortMessageAC[] PROGMEM = "Auto-arm on";
+static const char statusShortMessageAD[] PROGMEM = "Auto-arm off";
+static const char statusShortMessageAF[] PROGMEM = "System test";
+static const char statusShortMessageB0[] PROGMEM = "Enable DLS";
+static const char statusShortMessageB2[] PROGMEM = "Command output";
+static const char statusShortMessageB7[] PROGMEM = "Installer code";
+static const char statusShortMessageB9[] PROGMEM = "Zone tamper";
+static const char statusShortMessageBA[] PROGMEM = "Zones low batt.";
+static const char statusShortMessageC6[] PROGMEM = "Zone fault menu";
+static const char statusShortMessageC8[] PROGMEM = "Service required";
+static const char statusShortMessageD0[] PROGMEM = "Keypads low batt";
+static const char statusShortMessageD1[] PROGMEM = "Wireless low bat";
+static const char statusShortMessageE4[] PROGMEM = "Installer menu";
+static const char statusShortMessageE5[] PROGMEM = "Keypad slot";
+static const char statusShortMessageE6[] PROGMEM = "Input: 2 digits";
+static const char statusShortMessageE7[] PROGMEM = "Input: 3 digits";
+static const char statusShortMessageE8[] PROGMEM = "Input: 4 digits";
+static const char statusShortMessageEA[] PROGMEM = "Code: 2 digits";
+static const char statusShortMessageEB[] PROGMEM = "Code: 4 digits";
+static const char statusShortMessageEC[] PROGMEM = "Input: 6 digits";
+static const char statusShortMessageED[] PROGMEM = "Input: 32 digits";
+static const char statusShortMessageEE[] PROGMEM = "Input: option";
+static const char statusShortMessageF0[] PROGMEM = "Function key 1";
+static const char statusShortMessageF1[] PROGMEM = "Function key 2";
+static const char statusShortMessageF2[] PROGMEM = "Function key 3";
+static const char statusShortMessageF3[] PROGMEM = "Function key 4";
+static const char statusShortMessageF4[] PROGMEM = "Function key 5";
+static const char statusShortMessageF8[] PROGMEM = "Keypad program";
+
+static const char * const statusMessages[] PROGMEM = {
+  statusMessage01, statusMessage02, statusMessage03, statusMessage04, statusMessage05, statusMessage07,
+  statusMessage08, statusMessage09, statusMessage0B, statusMessage0C, statusMessage0D, statusMessage10,
+  statusMessage11, statusMessage14, statusMessage15, statusMessage16, statusMessage22, statusMessage33,
+  statusMessage3D, statusMessage3E, statusMessage40, statusMessage8A, statusMessage8B, statusMessage8E,
+  statusMessage8F, statusMessage9E, statusMessage9F, statusMessageA0, statusMessageA1, statusMessageA2,
+  statusMessageA3, statusMessageA4, statusMessageA5, statusMessageA6, statusMessageA7, statusMessageA9,
+  statusMessageAA, statusMessageAB, statusMessageAC, statusMessageAD, statusMessageAF, statusMessageB0,
+  statusMessageB2, statusMessageB7, statusMessageB8, statusMessageB9, statusMessageBA, statusMessageC6,
+  statusMessageC8, statusMessageD0, statusMessageD1, statusMessageE4, statusMessageE5, statusMessageE6,
+  statusMessageE7, statusMessageE8, statusMessageEA, statusMessageEB, statusMessageEC, statusMessageED,
+  statusMessageEE, statusMessageF0, statusMessageF1, statusMessageF2, statusMessageF3, statusMessageF4,
+  statusMessageF8
+};
+
+static const char * const statusShortMessages[] PROGMEM = {
+  statusShortMessage01, statusShortMessage02, statusShortMessage03, statusShortMessage04, statusShortMessage05,
+  statusShortMessage07, statusShortMessage08, statusShortMessage09, statusShortMessage0B, statusShortMessage0C,
+  statusShortMessage0D, statusShortMessage10, statusShortMessage11, statusShortMessage14, statusShortMessage15,
+  statusShortMessage09, statusShortMessage0D, statusShortMessage33, statusShortMessage3D, statusShortMessage3D,
+  statusShortMessage40, statusShortMessage8A, statusShortMessage0B, statusShortMessage8E, statusShortMessage8F,
+  statusShortMessage9E, statusShortMessage9F, statusShortMessageA0, statusShortMessageA1, statusShortMessage0D,
+  statusShortMessageA3, statusShortMessageA4, statusShortMessageA5, statusShortMessageA6, statusShortMessageA7,
+  statusShortMessageA9, statusShortMessageAA, statusShortMessageAB, statusShortMessageAC, statusShortMessageAD,
+  statusShortMessageAF, statusShortMessageB0, statusShortMessageB2, statusShortMessageB7, statusShortMessage9E,
+  statusShortMessageB9, statusShortMessageBA, statusShortMessageC6, statusShortMessageC8, statusShortMessageD0,
+  statusShortMessageD1, statusShortMessageE4, statusShortMessageE5, statusShortMessageE6, statusShortMessageE7,
+  statusShortMessageE8, statusShortMessageEA, statusShortMessageEB, statusShortMessageEC, statusShortMessageED,
+  statusShortMessageEE, statusShortMessageF0, statusShortMessageF1, statusShortMessageF2, statusShortMessageF3,
+  statusShortMessageF4, statusShortMessageF8
+};
+
+static const byte statusMessageIndex[256] PROGMEM = {
+   0,  1,  2,  3,  4,  5,  0,  6,  7,  8,  0,  9, 10, 11,  0,  0,  // 0x00
+  12, 13,  0,  0, 14, 15, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x10
+   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x20
+   0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19, 20,  0,  // 0x30
+  21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x40
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x50
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x60
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0x70
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22, 23,  0,  0, 24, 25,  // 0x80
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26, 27,  // 0x90
+  28, 29, 30, 31, 32, 33, 34, 35,  0, 36, 37, 38, 39, 40,  0, 41,  // 0xA0
+  42,  0, 43,  0,  0,  0,  0, 44, 45, 46, 47,  0,  0,  0,  0,  0,  // 0xB0
+   0,  0,  0,  0,  0,  0, 48,  0, 49,  0,  0,  0,  0,  0,  0,  0,  // 0xC0
+  50, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0xD0
+   0,  0,  0,  0, 52, 53, 54, 55, 56,  0, 57, 58, 59, 60, 61,  0,  // 0xE0
+  62, 63, 64, 65, 66,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0   // 0xF0
+};
+
+
+const __FlashStringHelper *dscStatusMessage(byte status, bool shortMessage) {
+  byte entry = pgm_read_byte(&statusMessageIndex[status]);
+  if (entry == 0) return NULL;
+  if (shortMessage) return (const __FlashStringHelper *)pgm_read_ptr(&statusShortMessages[entry - 1]);
+  else return (const __FlashStringHelper *)pgm_read_ptr(&statusMessages[entry - 1]);
+}
+
+
+byte dscCopyStatusMessage(byte status, char buffer[], byte bufferSize, bool shortMessage) {
+  if (bufferSize == 0) return 0;
+  buffer[0] = '\0';
+  const char *message = (const char *)dscStatusMessage(status, shortMessage);
+  if (message == NULL) return 0;
+  strncpy_P(buffer, message, bufferSize - 1);
+  buffer[bufferSize - 1] = '\0';
+  return strlen(buffer);
+}
+
+
 // Messages for commands 0x05, 0x0A, 0x1B, 0x27, 0x2D, 0x34, 0x3E
 void dscKeybusInterface::printPanelMessages(byte panelByte) {
-  switch (panelData[panelByte]) {
-    case 0x01: stream->print(F("Partition ready")); break;
-    case 0x02: stream->print(F("Stay/away zones open")); break;
-    case 0x03: stream->print(F("Zones open")); break;
-    case 0x04: stream->print(F("Armed stay")); break;
-    case 0x05: stream->print(F("Armed away")); break;
-    case 0x07: stream->print(F("Failed to arm")); break;
-    case 0x08: stream->print(F("Exit delay in progress")); break;
-    case 0x09: stream->print(F("Arming with no entry delay")); break;
-    case 0x0B: stream->print(F("Quick exit in progress")); break;
-    case 0x0C: stream->print(F("Entry delay in progress")); break;
-    case 0x0D: stream->print(F("Opening after alarm")); break;
-    case 0x10: stream->print(F("Keypad lockout")); break;
-    case 0x11: stream->print(F("Partition in alarm")); break;
-    case 0x14: stream->print(F("Auto-arm in progress")); break;
-    case 0x15: stream->print(F("Arming with bypassed zones")); break;
-    case 0x16: stream->print(F("Armed with no entry delay")); break;
-    case 0x22: stream->print(F("Recent closing")); break;
-    case 0x33: stream->print(F("Command output in progress")); break;
-    case 0x3D: stream->print(F("Disarmed after alarm in memory")); break;
-    case 0x3E: stream->print(F("Partition disarmed")); break;
-    case 0x40: stream->print(F("Keypad blanked")); break;
-    case 0x8A: stream->print(F("Activate stay/away zones")); break;
-    case 0x8B: stream->print(F("Quick exit")); break;
-    case 0x8E: stream->print(F("Invalid option")); break;
-    case 0x8F: stream->print(F("Invalid access code")); break;
-    case 0x9E: stream->print(F("Enter * function code")); break;
-    case 0x9F: stream->print(F("Enter access code")); break;
-    case 0xA0: stream->print(F("*1: Zone bypass programming")); break;
-    case 0xA1: stream->print(F("*2: Trouble menu")); break;
-    case 0xA2: stream->print(F("*3: Alarm memory display")); break;
-    case 0xA3: stream->print(F("Door chime enabled")); break;
-    case 0xA4: stream->print(F("Door chime disabled")); break;
-    case 0xA5: stream->print(F("Enter master code")); break;
-    case 0xA6: stream->print(F("*5: Access codes")); break;
-    case 0xA7: stream->print(F("*5: Enter new code")); break;
-    case 0xA9: stream->print(F("*6: User functions")); break;
-    case 0xAA: stream->print(F("*6: Time and Date")); break;
-    case 0xAB: stream->print(F("*6: Auto-arm time")); break;
-    case 0xAC: stream->print(F("*6: Auto-arm enabled")); break;
-    case 0xAD: stream->print(F("*6: Auto-arm disabled")); break;
-    case 0xAF: stream->print(F("*6: System test")); break;
-    case 0xB0: stream->print(F("*6: Enable DLS")); break;
-    case 0xB2: stream->print(F("*7: Command output")); break;
-    case 0xB7: stream->print(F("Enter installer code")); break;
-    case 0xB8: stream->print(F("*  pressed while armed")); break;
-    case 0xB9: stream->print(F("*2: Zone tamper menu")); break;
-    case 0xBA: stream->print(F("*2: Zones with low batteries")); break;
-    case 0xC6: stream->print(F("*2: Zone fault menu")); break;
-    case 0xC8: stream->print(F("*2: Service required menu")); break;
-    case 0xD0: stream->print(F("*2: Handheld keypads with low batteries")); break;
-    case 0xD1: stream->print(F("*2: Wireless keys with low batteries")); break;
-    case 0xE4: stream->print(F("*8: Main menu")); break;
-    case 0xE5: stream->print(F("Keypad slot assignment")); break;
-    case 0xE6: stream->print(F("*8: Input required: 2 digits")); break;
-    case 0xE7: stream->print(F("*8: Input required: 3 digits")); break;
-    case 0xE8: stream->print(F("*8: Input required: 4 digits")); break;
-    case 0xEA: stream->print(F("*8: Reporting code: 2 digits")); break;
-    case 0xEB: stream->print(F("*8: Telephone number account code: 4 digits")); break;
-    case 0xEC: stream->print(F("*8: Input required: 6 digits")); break;
-    case 0xED: stream->print(F("*8: Input required: 32 digits")); break;
-    case 0xEE: stream->print(F("*8: Input required: 1 option per zone")); break;
-    case 0xF0: stream->print(F("Function key 1 programming")); break;
-    case 0xF1: stream->print(F("Function key 2 programming")); break;
-    case 0xF2: stream->print(F("Function key 3 programming")); break;
-    case 0xF3: stream->print(F("Function key 4 programming")); break;
-    case 0xF4: stream->print(F("Function key 5 programming")); break;
-    case 0xF8: stream->print(F("Keypad programming")); break;
-    default:
-      stream->print(F("Unrecognized data"));
-      stream->print(F(": 0x"));
-      if (panelData[panelByte] < 10) stream->print(F("0"));
-      stream->print(panelData[panelByte], HEX);
-      break;
+  const __FlashStringHelper *message = dscStatusMessage(panelData[panelByte]);
+  if (message != NULL) stream->print(message);
+  else {
+    stream->print(F("Unrecognized data"));
+    stream->print(F(": 0x"));
+    if (panelData[panelByte] < 10) stream->print(F("0"));
+    stream->print(panelData[panelByte], HEX);
   }
 }
 
@@ -2129,7 +2267,7 @@ void dscKeybusInterface::printModule_Keys() {
   stream->print(F("[Keypad] "));
 
   byte keyByte = 2;
-  if (currentCmd == 0x05) {
+  if (moduleCmd == 0x05) {
     if (moduleData[2] != 0xFF) {
       stream->print(F("Partition 1 | Key: "));
     }
@@ -2147,7 +2285,7 @@ void dscKeybusInterface::printModule_Keys() {
       keyByte = 9;
     }
   }
-  else if (currentCmd == 0x1B) {
+  else if (moduleCmd == 0x1B) {
     if (moduleData[2] != 0xFF) {
       stream->print(F("Partition 5 | Key: "));
     }
@@ -2216,21 +2354,26 @@ void dscKeybusInterface::printModule_Keys() {
  * Print binary
  */
 
+// Each byte is printed with a single print() call
 void dscKeybusInterface::printPanelBinary(bool printSpaces) {
+  char binary[10];
   for (byte panelByte = 0; panelByte < panelByteCount; panelByte++) {
+    byte binaryCount = 0;
     if (panelByte == 1) stream->print(panelData[panelByte]);  // Prints the stop bit
     else {
       for (byte mask = 0x80; mask; mask >>= 1) {
-        if (mask & panelData[panelByte]) stream->print("1");
-        else stream->print("0");
+        if (mask & panelData[panelByte]) binary[binaryCount++] = '1';
+        else binary[binaryCount++] = '0';
       }
     }
-    if (printSpaces && (panelByte != panelByteCount - 1 || displayTrailingBits)) stream->print(" ");
+    if (printSpaces && (panelByte != panelByteCount - 1 || displayTrailingBits)) binary[binaryCount++] = ' ';
+    binary[binaryCount] = '\0';
+    stream->print(binary);
   }
 
   if (displayTrailingBits) {
     byte trailingBits = (panelBitCount - 1) % 8;
-    if (trailingBits > 0) {
+    if (trailingBits > 0 && panelByteCount < dscReadSize) {  // Full-length commands do not store trailing bits
       for (int i = trailingBits - 1; i >= 0; i--) {
         stream->print(bitRead(panelData[panelByteCount], i));
       }
@@ -2240,7 +2383,9 @@ void dscKeybusInterface::printPanelBinary(bool printSpaces) {
 
 
 void dscKeybusInterface::printModuleBinary(bool printSpaces) {
+  char binary[10];
   for (byte moduleByte = 0; moduleByte < moduleByteCount; moduleByte++) {
+    byte binaryCount = 0;
     if (moduleByte == 1) stream->print(moduleData[moduleByte]);  // Prints the stop bit
     else if (hideKeypadDigits
             && (moduleByte == 2 || moduleByte == 3 || moduleByte == 8 || moduleByte == 9)
@@ -2249,16 +2394,18 @@ void dscKeybusInterface::printModuleBinary(bool printSpaces) {
               stream->print(F("........"));  // Hides keypad digits
     else {
       for (byte mask = 0x80; mask; mask >>= 1) {
-        if (mask & moduleData[moduleByte]) stream->print("1");
-        else stream->print("0");
+        if (mask & moduleData[moduleByte]) binary[binaryCount++] = '1';
+        else binary[binaryCount++] = '0';
       }
     }
-    if (printSpaces && (moduleByte != moduleByteCount - 1 || displayTrailingBits)) stream->print(" ");
+    if (printSpaces && (moduleByte != moduleByteCount - 1 || displayTrailingBits)) binary[binaryCount++] = ' ';
+    binary[binaryCount] = '\0';
+    stream->print(binary);
   }
 
   if (displayTrailingBits) {
     byte trailingBits = (moduleBitCount - 1) % 8;
-    if (trailingBits > 0) {
+    if (trailingBits > 0 && moduleByteCount < dscReadSize) {  // Full-length commands do not store trailing bits
       for (int i = trailingBits - 1; i >= 0; i--) {
         stream->print(bitRead(moduleData[moduleByteCount], i));
       }
@@ -2267,6 +2414,185 @@ void dscKeybusInterface::printModuleBinary(bool printSpaces) {
 }
 
 
+/*
+ * Print binary capture
+ *
+ * Writes Keybus data as binary frames for high-speed capture, a fraction of the size of printPanelBinary() and
+ * printModuleBinary() with the same data.  Each frame is encoded with COBS (Consistent Overhead Byte Stuffing)
+ * so that it contains no 0x00 bytes, and ends with 0x00.  Decoded frames:
+ *
+ *   Panel:  length, 'P', bit count (bit 7 set if the CRC is valid), sequence, capture time in micros() as 4 bytes
+ *           least significant byte first, data bytes
+ *   Module: length, 'M', bit count, sequence, panel command, data bytes
+ *   Buffer overflow: length, 'O' - written by the sketch when bufferOverflow is set, Keybus commands were dropped
+ *           before the next panel command
+ *
+ * The length is the number of bytes in the decoded frame including the length byte.  The data bytes are as in
+ * panelData[] and moduleData[]: the command, the stop bit as a full byte, the remaining data, and the byte with any
+ * trailing bits.  Keypad and module data does not have a capture time, the sequence number matches the panel command
+ * sent at the same time.
+ */
+
+void dscKeybusInterface::printPanelCapture() {
+  byte frame[dscReadSize + 8];
+  byte dataCount = panelByteCount + 1;
+  if (dataCount > dscReadSize) dataCount = dscReadSize;
+
+  frame[1] = 'P';
+  frame[2] = panelBitCount;
+  if (panelCRC) frame[2] |= 0x80;
+  frame[3] = panelSequence;
+  for (byte i = 0; i < 4; i++) frame[4 + i] = panelTime >> (i * 8);
+  for (byte i = 0; i < dataCount; i++) frame[8 + i] = panelData[i];
+  printCaptureFrame(frame, dataCount + 8);
+}
+
+
+void dscKeybusInterface::printModuleCapture() {
+  byte frame[dscReadSize + 5];
+  byte dataCount = moduleByteCount + 1;
+  if (dataCount > dscReadSize) dataCount = dscReadSize;
+
+  frame[1] = 'M';
+  frame[2] = moduleBitCount;
+  frame[3] = moduleSequence;
+  frame[4] = moduleCmd;
+  for (byte i = 0; i < dataCount; i++) frame[5 + i] = moduleData[i];
+  printCaptureFrame(frame, dataCount + 5);
+}
+
+
+void dscKeybusInterface::printOverflowCapture() {
+  byte frame[2];
+  frame[1] = 'O';
+  printCaptureFrame(frame, 2);
+}
+
+
+// Sets the length in frame[0] and writes the frame with COBS encoding in a single write: each 0x00 is replaced
+// by the distance to the next 0x00, with the distance to the first 0x00 added before the frame.  Frames are less
+// than 254 bytes, so each 0x00 is encoded with a single byte.
+void dscKeybusInterface::printCaptureFrame(byte frame[], byte frameLength) {
+  byte encoded[dscReadSize + 10];
+  frame[0] = frameLength;
+  byte codeIndex = 0;
+  byte encodedLength = 1;
+  for (byte i = 0; i < frameLength; i++) {
+    if (frame[i] == 0) {
+      encoded[codeIndex] = encodedLength - codeIndex;
+      codeIndex = encodedLength++;
+    }
+    else encoded[encodedLength++] = frame[i];
+  }
+  encoded[codeIndex] = encodedLength - codeIndex;
+  encoded[encodedLength++] = 0;
+  stream->write(encoded, encodedLength);
+}
+
+
+// Loads a capture frame, after COBS decoding, into panelData[] or moduleData[] as handlePanel() and handleModule()
+// would, so captures can be printed later with the print functions.  Returns 'P' for panel data, 'M' for keypad
+// or module data, 'O' for a buffer overflow marker, or 0 if the frame is not valid.
+byte dscKeybusInterface::loadCapture(const byte frame[], byte frameLength) {
+  if (frameLength == 2 && frame[0] == 2 && frame[1] == 'O') return 'O';
+  if (frameLength < 5 || frame[0] != frameLength) return 0;
+  byte bitCount = frame[2];
+  if (frame[1] == 'P') bitCount &= 0x7F;  // CRC result
+
+  // Byte counts as set by captureData(): panel data counts the stop bit in byte 1 after bit 8, keypad and
+  // module data skips byte 1 after bit 7
+  byte byteCount;
+  if (frame[1] == 'P') byteCount = (bitCount + 7) / 8;
+  else byteCount = bitCount / 8 + 1;
+  if (byteCount > dscReadSize) byteCount = dscReadSize;
+  if (bitCount < 8 || bitCount > dscReadSize * 8) return 0;
+  byte dataCount = byteCount + 1;  // Includes the byte with any trailing bits, except for full-length commands
+  if (dataCount > dscReadSize) dataCount = dscReadSize;
+
+  switch (frame[1]) {
+    case 'P':
+      if (frameLength != dataCount + 8) return 0;
+      for (byte i = 0; i < dscReadSize; i++) panelData[i] = i < dataCount ? frame[8 + i] : 0;
+      panelBitCount = bitCount;
+      panelByteCount = byteCount;
+      panelCRC = frame[2] & 0x80;
+      panelSequence = frame[3];
+      panelTime = 0;
+      for (byte i = 0; i < 4; i++) panelTime |= (unsigned long)frame[4 + i] << (i * 8);
+      return 'P';
+
+    case 'M':
+      if (frameLength != dataCount + 5) return 0;
+      for (byte i = 0; i < dscReadSize; i++) moduleData[i] = i < dataCount ? frame[5 + i] : 0;
+      moduleBitCount = bitCount;
+      moduleByteCount = byteCount;
+      moduleSequence = frame[3];
+      moduleCmd = frame[4];
+      switch (moduleCmd) {
+        case 0x11:
+        case 0x28:
+        case 0xD5: queryResponse = true; break;
+        default: queryResponse = false; break;
+      }
+      return 'M';
+
+    default: return 0;
+  }
+}
+
+
+/*
+ * Print saved panel records
+ */
+
+void dscKeybusInterface::getPanelRecord(dscPanelRecord &record) {
+  for (byte i = 0; i < dscReadSize; i++) record.data[i] = panelData[i];
+  record.bitCount = panelBitCount;
+  record.crc = panelCRC;
+  record.sequence = panelSequence;
+  record.time = panelTime;
+}
+
+
+// Loads a record into panelData[] for the print functions
+void dscKeybusInterface::setPanelRecord(const dscPanelRecord &record) {
+  for (byte i = 0; i < dscReadSize; i++) panelData[i] = record.data[i];
+  panelBitCount = record.bitCount;
+  panelByteCount = (record.bitCount + 7) / 8;
+  panelCRC = record.crc;
+  panelSequence = record.sequence;
+  panelTime = record.time;
+}
+
+
+// Each record is printed by temporarily loading it in place of the current command, which is restored afterwards
+void dscKeybusInterface::printPanelBinary(const dscPanelRecord &record, bool printSpaces) {
+  dscPanelRecord currentRecord;
+  getPanelRecord(currentRecord);
+  setPanelRecord(record);
+  printPanelBinary(printSpaces);
+  setPanelRecord(currentRecord);
+}
+
+
+void dscKeybusInterface::printPanelCommand(const dscPanelRecord &record) {
+  dscPanelRecord currentRecord;
+  getPanelRecord(currentRecord);
+  setPanelRecord(record);
+  printPanelCommand();
+  setPanelRecord(currentRecord);
+}
+
+
+void dscKeybusInterface::printPanelMessage(const dscPanelRecord &record) {
+  dscPanelRecord currentRecord;
+  getPanelRecord(currentRecord);
+  setPanelRecord(record);
+  printPanelMessage();
+  setPanelRecord(currentRecord);
+}
+
+
 /*
  * Print panel command as hex
  */
@@ -2276,3 +2602,125 @@ void dscKeybusInterface::printPanelCommand() {
   if (panelData[0] < 16) stream->print("0");
   stream->print(panelData[0], HEX);
 }
+
+
+/*
+ * Buffered output
+ */
+
+dscBufferedStream::dscBufferedStream(Stream &_output, byte *_buffer, unsigned int _bufferSize, unsigned long _bytesPerSecond, bool _rateOnly) {
+  output = &_output;
+  buffer = _buffer;
+  bufferSize = _bufferSize;
+  bytesPerSecond = _bytesPerSecond;
+  rateOnly = _rateOnly;
+  bufferHead = 0;
+  bufferTail = 0;
+  lineStart = 0;
+  lineDropped = false;
+  budget = 0;
+  budgetTime = millis();
+  droppedBytes = 0;
+  droppedLines = 0;
+}
+
+
+unsigned int dscBufferedStream::bufferCount() {
+  if (bufferHead >= bufferTail) return bufferHead - bufferTail;
+  else return bufferSize - bufferTail + bufferHead;
+}
+
+
+int dscBufferedStream::availableForWrite() {
+  return bufferSize - 1 - bufferCount();
+}
+
+
+// Buffers a byte, or drops the line if the buffer is full - the start of the line is removed from the buffer and
+// the rest of the line is discarded as it is printed, so that only complete lines are written
+size_t dscBufferedStream::write(uint8_t data) {
+  if (lineDropped) {
+    droppedBytes++;
+    if (data == '\n') lineDropped = false;
+    return 1;
+  }
+
+  unsigned int nextHead = bufferHead + 1;
+  if (nextHead == bufferSize) nextHead = 0;
+  if (nextHead == bufferTail) {
+    update();
+    if (nextHead == bufferTail) {
+      if (bufferHead >= lineStart) droppedBytes += bufferHead - lineStart + 1;
+      else droppedBytes += bufferSize - lineStart + bufferHead + 1;
+      droppedLines++;
+      bufferHead = lineStart;
+      if (data != '\n') lineDropped = true;
+      return 1;
+    }
+  }
+
+  buffer[bufferHead] = data;
+  bufferHead = nextHead;
+  if (data == '\n') lineStart = bufferHead;
+  return 1;
+}
+
+
+size_t dscBufferedStream::write(const uint8_t *data, size_t size) {
+  for (size_t i = 0; i < size; i++) write(data[i]);
+  return size;
+}
+
+
+// Writes complete lines from the buffer as contiguous blocks, limited by the byte rate and the space available in
+// the output - nothing is written while the output reports no space, unless the stream is rate-only.  The byte rate
+// budget accumulates while idle up to burstBytes, so a full buffer is not written in a single burst.
+void dscBufferedStream::update() {
+  if (bytesPerSecond > 0) {
+    unsigned long elapsedMillis = millis() - budgetTime;
+    if (elapsedMillis > 0) {
+      budgetTime += elapsedMillis;
+      if (elapsedMillis > 1000) elapsedMillis = 1000;
+      budget += elapsedMillis * bytesPerSecond;
+      unsigned long budgetLimit = burstBytes * 1000UL;
+      if (budgetLimit < bytesPerSecond) budgetLimit = bytesPerSecond;  // At least 1ms of output at the byte rate
+      if (budget > budgetLimit) budget = budgetLimit;
+    }
+  }
+
+  while (bufferTail != lineStart) {
+    unsigned int writeCount;
+    if (lineStart > bufferTail) writeCount = lineStart - bufferTail;
+    else writeCount = bufferSize - bufferTail;
+
+    if (!rateOnly) {
+      int outputSpace = output->availableForWrite();
+      if (outputSpace <= 0) return;
+      if (writeCount > (unsigned int)outputSpace) writeCount = outputSpace;
+    }
+    if (bytesPerSecond > 0) {
+      if (writeCount > budget / 1000) writeCount = budget / 1000;
+      if (writeCount == 0) return;
+      budget -= writeCount * 1000UL;
+    }
+
+    output->write(buffer + bufferTail, writeCount);
+    bufferTail += writeCount;
+    if (bufferTail == bufferSize) bufferTail = 0;
+  }
+}
+
+
+// Writes all buffered data including an incomplete line, ignoring the byte rate
+void dscBufferedStream::flush() {
+  while (bufferTail != bufferHead) {
+    unsigned int writeCount;
+    if (bufferHead > bufferTail) writeCount = bufferHead - bufferTail;
+    else writeCount = bufferSize - bufferTail;
+    output->write(buffer + bufferTail, writeCount);
+    bufferTail += writeCount;
+    if (bufferTail == bufferSize) bufferTail = 0;
+  }
+  lineStart = bufferHead;
+  output->flush();
+}
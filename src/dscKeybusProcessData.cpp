@@ -17,469 +17,334 @@
 
 #include "dscKeybusInterface.h"
 
-
-// Processes 0x05 and 0x1B commands
-void dscKeybusInterface::processPanelStatus() {
+// Partition status transitions for each status message in processPanelStatus(): ready is set by the listed flag
+// and cleared otherwise, exit and entry delay are only changed by the listed flags, and writeArm is cleared once
+// the panel has armed or started the exit delay
+const byte statusReady = 0x01;
+const byte statusSetExitDelay = 0x02;
+const byte statusClearExitDelay = 0x04;
+const byte statusSetEntryDelay = 0x08;
+const byte statusClearEntryDelay = 0x10;
+const byte statusClearWriteArm = 0x20;
+
+const byte statusTransitions[][2] PROGMEM = {
+  {0x01, statusReady},                                                       // Partition ready
+  {0x02, statusReady},                                                       // Stay/away zones open
+  {0x03, statusClearExitDelay | statusClearEntryDelay},                      // Zones open
+  {0x04, statusClearWriteArm | statusClearExitDelay | statusClearEntryDelay},  // Armed stay
+  {0x05, statusClearWriteArm | statusClearExitDelay | statusClearEntryDelay},  // Armed away
+  {0x08, statusClearWriteArm | statusSetExitDelay},                          // Exit delay in progress
+  {0x0C, statusSetEntryDelay},                                               // Entry delay in progress
+  {0x11, statusClearExitDelay | statusClearEntryDelay},                      // Partition in alarm
+  {0x3E, statusClearExitDelay | statusClearEntryDelay}                       // Partition disarmed
+};
+
+
+// Applies the partition lights and status messages from 0x05 and 0x1B commands
+void dscKeybusInterface::processPanelStatus(const dscPanelStatus &panelStatus) {
 
   // Trouble status
-  if (bitRead(panelData[2],4)) trouble = true;
-  else trouble = false;
-  if (trouble != previousTrouble && (panelData[3] < 0x05 || panelData[3] == 0xC7)) {  // Ignores trouble light status in intermittent states
+  trouble = panelStatus.trouble;
+  if (trouble != previousTrouble && panelStatus.troubleStable) {  // Ignores trouble light status in intermittent states
     previousTrouble = trouble;
     troubleChanged = true;
     statusChanged = true;
+    processEvent(dscEventTrouble, 0, trouble);
   }
 
-  byte partitionStart = 0;
-  byte partitionCount = 0;
-  if (panelData[0] == 0x05) {
-    partitionStart = 0;
-    if (panelByteCount < 9) partitionCount = 2;
-    else partitionCount = 4;
-    if (dscPartitions < partitionCount) partitionCount = dscPartitions;
-  }
-  else if (dscPartitions > 4 && panelData[0] == 0x1B) {
-    partitionStart = 4;
-    partitionCount = 8;
-  }
+  byte partitionStart = panelStatus.partitionStart;
+  byte partitionCount = panelStatus.partitionCount;
+  if (partitionStart >= dscPartitions) return;
+  if (partitionStart + partitionCount > dscPartitions) partitionCount = dscPartitions - partitionStart;
 
-  for (byte partitionIndex = partitionStart; partitionIndex < partitionCount; partitionIndex++) {
-    byte statusByte, messageByte;
-    if (partitionIndex < 4) {
-      statusByte = (partitionIndex * 2) + 2;
-      messageByte = (partitionIndex * 2) + 3;
-    }
-    else {
-      statusByte = ((partitionIndex - 4) * 2) + 2;
-      messageByte = ((partitionIndex - 4) * 2) + 3;
-    }
+  for (byte statusIndex = 0; statusIndex < partitionCount; statusIndex++) {
+    byte partitionIndex = partitionStart + statusIndex;
+    byte lights = panelStatus.lights[statusIndex];
+    byte message = panelStatus.messages[statusIndex];
 
     // Status lights
-    lights[partitionIndex] = panelData[statusByte];
-    if (lights[partitionIndex] != previousLights[partitionIndex]) {
-      previousLights[partitionIndex] = lights[partitionIndex];
+    partitions[partitionIndex].lights = lights;
+    if (partitions[partitionIndex].lights != partitions[partitionIndex].previousLights) {
+      partitions[partitionIndex].previousLights = partitions[partitionIndex].lights;
       statusChanged = true;
     }
 
     // Status messages
-    status[partitionIndex] = panelData[messageByte];
-    if (status[partitionIndex] != previousStatus[partitionIndex]) {
-      previousStatus[partitionIndex] = status[partitionIndex];
+    partitions[partitionIndex].status = message;
+    if (partitions[partitionIndex].status != partitions[partitionIndex].previousStatus) {
+      partitions[partitionIndex].previousStatus = partitions[partitionIndex].status;
       statusChanged = true;
     }
 
     // Fire status
-    if (bitRead(panelData[statusByte],6)) fire[partitionIndex] = true;
-    else fire[partitionIndex] = false;
-    if (fire[partitionIndex] != previousFire[partitionIndex] && panelData[messageByte] < 0x12) {  // Ignores fire light status in intermittent states
-      previousFire[partitionIndex] = fire[partitionIndex];
-      fireChanged[partitionIndex] = true;
-      statusChanged = true;
+    if (bitRead(lights,6)) partitions[partitionIndex].fire = true;
+    else partitions[partitionIndex].fire = false;
+    if (partitions[partitionIndex].fire != partitions[partitionIndex].previousFire && message < 0x12) {  // Ignores fire light status in intermittent states
+      partitions[partitionIndex].previousFire = partitions[partitionIndex].fire;
+      setPartitionChanged(partitionIndex, dscFireChanged);
     }
 
 
     // Messages
-    switch (panelData[messageByte]) {
-      case 0x01:         // Partition ready
-      case 0x02: {       // Stay/away zones open
-        ready[partitionIndex] = true;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-      case 0x03: {       // Zones open
-        exitDelay[partitionIndex] = false;
-        if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-          previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-          exitDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        entryDelay[partitionIndex] = false;
-        if (entryDelay[partitionIndex] != previousEntryDelay[partitionIndex]) {
-          previousEntryDelay[partitionIndex] = entryDelay[partitionIndex];
-          entryDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-
-      case 0x04:         // Armed stay
-      case 0x05: {       // Armed away
-        writeArm[partitionIndex] = false;
-        exitDelay[partitionIndex] = false;
-        if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-          previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-          exitDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        entryDelay[partitionIndex] = false;
-        if (entryDelay[partitionIndex] != previousEntryDelay[partitionIndex]) {
-          previousEntryDelay[partitionIndex] = entryDelay[partitionIndex];
-          entryDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-
-      case 0x08: {       // Exit delay in progress
-        writeArm[partitionIndex] = false;
-        exitDelay[partitionIndex] = true;
-        if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-          previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-          exitDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-
-      case 0x0C: {       // Entry delay in progress
-        entryDelay[partitionIndex] = true;
-        if (entryDelay[partitionIndex] != previousEntryDelay[partitionIndex]) {
-          previousEntryDelay[partitionIndex] = entryDelay[partitionIndex];
-          entryDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-
-      case 0x11: {       // Partition in alarm
-        exitDelay[partitionIndex] = false;
-        if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-          previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-          exitDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        entryDelay[partitionIndex] = false;
-        if (entryDelay[partitionIndex] != previousEntryDelay[partitionIndex]) {
-          previousEntryDelay[partitionIndex] = entryDelay[partitionIndex];
-          entryDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
+    byte transitions = 0;
+    for (byte i = 0; i < sizeof(statusTransitions) / sizeof(statusTransitions[0]); i++) {
+      if (pgm_read_byte(&statusTransitions[i][0]) == message) {
+        transitions = pgm_read_byte(&statusTransitions[i][1]);
         break;
       }
+    }
 
-      case 0x3E: {       // Partition disarmed
-        exitDelay[partitionIndex] = false;
-        if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-          previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-          exitDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        entryDelay[partitionIndex] = false;
-        if (entryDelay[partitionIndex] != previousEntryDelay[partitionIndex]) {
-          previousEntryDelay[partitionIndex] = entryDelay[partitionIndex];
-          entryDelayChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
+    if (transitions & statusClearWriteArm) partitions[partitionIndex].writeArm = false;
+    if (transitions & (statusSetExitDelay | statusClearExitDelay)) {
+      processStatusChange(transitions & statusSetExitDelay, partitionIndex, dscExitDelayChanged);
+    }
+    if (transitions & (statusSetEntryDelay | statusClearEntryDelay)) {
+      processStatusChange(transitions & statusSetEntryDelay, partitionIndex, dscEntryDelayChanged);
+    }
+    processStatusChange(transitions & statusReady, partitionIndex, dscReadyChanged);
 
-      case 0x9E: {       // Enter * function code
+    // Virtual keypad
+    switch (message) {
+      case 0x9E:         // Enter * function code
         wroteAsterisk = false;  // Resets the flag that delays writing after '*' is pressed
         writeAsterisk = false;
         writeReady = true;
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
         break;
-      }
 
-      case 0x9F: {
-        if (writeArm[partitionIndex]) {  // Ensures access codes are only sent when an arm command is sent through this interface
+      case 0x9F:
+        if (partitions[partitionIndex].writeArm) {  // Ensures access codes are only sent when an arm command is sent through this interface
           accessCodePrompt = true;
           statusChanged = true;
-        }
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
-        }
-        break;
-      }
-
-      default: {
-        ready[partitionIndex] = false;
-        if (ready[partitionIndex] != previousReady[partitionIndex]) {
-          previousReady[partitionIndex] = ready[partitionIndex];
-          readyChanged[partitionIndex] = true;
-          statusChanged = true;
+          processEvent(dscEventAccessCode, partitionIndex + 1, 1);
         }
         break;
-      }
     }
   }
 }
 
 
-void dscKeybusInterface::processPanel_0x27() {
-  if (!validCRC()) return;
+// Sets a partition ready, exit delay, or entry delay status and its changed flag if the status is different from
+// the previous status
+void dscKeybusInterface::processStatusChange(bool currentStatus, byte partitionIndex, byte changedFlag) {
+  dscPartition &partition = partitions[partitionIndex];
+  bool previousStatus;
+  switch (changedFlag) {
+    case dscReadyChanged:
+      partition.ready = currentStatus;
+      previousStatus = partition.previousReady;
+      partition.previousReady = currentStatus;
+      break;
+    case dscExitDelayChanged:
+      partition.exitDelay = currentStatus;
+      previousStatus = partition.previousExitDelay;
+      partition.previousExitDelay = currentStatus;
+      break;
+    case dscEntryDelayChanged:
+      partition.entryDelay = currentStatus;
+      previousStatus = partition.previousEntryDelay;
+      partition.previousEntryDelay = currentStatus;
+      break;
+    default: return;
+  }
+  if (currentStatus != previousStatus) setPartitionChanged(partitionIndex, changedFlag);
+}
 
-  for (byte partitionIndex = 0; partitionIndex < 2; partitionIndex++) {
-    byte messageByte = (partitionIndex * 2) + 3;
 
-    // Messages
-    if (panelData[messageByte] == 0x04 || panelData[messageByte] == 0x05) {
-      if (panelData[messageByte] == 0x04) {
-        armedStay[partitionIndex] = true;
-        armedAway[partitionIndex] = false;
-      }
-      else if (panelData[messageByte] == 0x05) {
-        armedStay[partitionIndex] = false;
-        armedAway[partitionIndex] = true;
-      }
+void dscKeybusInterface::setPartitionChanged(byte partitionIndex, byte changedFlag) {
+  partitionChanged[partitionIndex] |= changedFlag;
+  partitionsChanged |= 1 << partitionIndex;
+  statusChanged = true;
 
-      exitDelay[partitionIndex] = false;
-      if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-        previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-        exitDelayChanged[partitionIndex] = true;
-        statusChanged = true;
-      }
-      armed[partitionIndex] = true;
-      if (previousArmed[partitionIndex] != true) {
-        previousArmed[partitionIndex] = true;
-        armedChanged[partitionIndex] = true;
-        statusChanged = true;
-      }
+  byte partition = partitionIndex + 1;
+  switch (changedFlag) {
+    case dscReadyChanged: processEvent(dscEventReady, partition, partitions[partitionIndex].ready); break;
+    case dscArmedChanged: {
+      byte armedMode = 0;
+      if (partitions[partitionIndex].armed) armedMode = partitions[partitionIndex].armedAway ? dscArmedAway : dscArmedStay;
+      processEvent(dscEventArmed, partition, armedMode);
+      break;
     }
+    case dscAlarmChanged: processEvent(dscEventAlarm, partition, partitions[partitionIndex].alarm); break;
+    case dscExitDelayChanged: processEvent(dscEventExitDelay, partition, partitions[partitionIndex].exitDelay); break;
+    case dscEntryDelayChanged: processEvent(dscEventEntryDelay, partition, partitions[partitionIndex].entryDelay); break;
+    case dscFireChanged: processEvent(dscEventFire, partition, partitions[partitionIndex].fire); break;
   }
+}
 
-  // Open zones 1-8 status is stored in openZones[0] and openZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-  openZones[0] = panelData[6];
-  byte zonesChanged = openZones[0] ^ previousOpenZones[0];
-  if (zonesChanged != 0) {
-    previousOpenZones[0] = openZones[0];
-    openZonesStatusChanged = true;
-    statusChanged = true;
 
-    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-      if (bitRead(zonesChanged, zoneBit)) {
-        bitWrite(openZonesChanged[0], zoneBit, 1);
-        if (bitRead(panelData[6], zoneBit)) bitWrite(openZones[0], zoneBit, 1);
-        else bitWrite(openZones[0], zoneBit, 0);
-      }
-    }
-  }
+// Sends a status change to the callbacks and the event queue, stamped with the panel command being processed
+void dscKeybusInterface::processEvent(byte type, byte number, byte value) {
+  processEvent(type, number, value, panelTime);
 }
 
 
-void dscKeybusInterface::processPanel_0x2D() {
-  if (!validCRC()) return;
-  if (dscZones < 2) return;
+void dscKeybusInterface::processEvent(byte type, byte number, byte value, unsigned long eventTime) {
+  dscEvent event;
+  event.type = type;
+  event.number = number;
+  event.value = value;
+  event.sequence = panelSequence;
+  event.time = eventTime;
+  if (timeAvailable) {
+    event.hour = hour;
+    event.minute = minute;
+  }
+  else {
+    event.hour = 255;
+    event.minute = 255;
+  }
 
-  // Open zones 9-16 status is stored in openZones[1] and openZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-  openZones[1] = panelData[6];
-  byte zonesChanged = openZones[1] ^ previousOpenZones[1];
-  if (zonesChanged != 0) {
-    previousOpenZones[1] = openZones[1];
-    openZonesStatusChanged = true;
-    statusChanged = true;
+  // Callbacks are filtered by zone, partition, and partition status
+  switch (type) {
+    case dscEventZoneOpen:
+      if (zoneCallback != NULL && (zoneCallbackZones & dscZoneBit(number - 1))) zoneCallback(event);
+      break;
+    case dscEventZoneAlarm:
+      if (zoneAlarmCallback != NULL && (zoneAlarmCallbackZones & dscZoneBit(number - 1))) zoneAlarmCallback(event);
+      break;
+    case dscEventReady:
+    case dscEventArmed:
+    case dscEventAlarm:
+    case dscEventExitDelay:
+    case dscEventEntryDelay:
+    case dscEventFire:
+      if (partitionCallback != NULL && (partitionCallbackPartitions & (1 << (number - 1))) && (partitionCallbackChanges & (1 << (type - 1)))) partitionCallback(event);
+      break;
+    case dscEventAccessCode:  // Available only from the event queue
+      break;
+    default:
+      if (troubleCallback != NULL) troubleCallback(event);
+      break;
+  }
 
-    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-      if (bitRead(zonesChanged, zoneBit)) {
-        bitWrite(openZonesChanged[1], zoneBit, 1);
-        if (bitRead(panelData[6], zoneBit)) bitWrite(openZones[1], zoneBit, 1);
-        else bitWrite(openZones[1], zoneBit, 0);
-      }
-    }
+  // Queues the event, or counts it as dropped if the queue is full - one entry is left unused so that a full
+  // queue can be distinguished from an empty one
+  #if defined(dscEvents)
+  byte nextHead = eventHead + 1;
+  if (nextHead == dscEventBufferSize) nextHead = 0;
+  if (nextHead == eventTail) {
+    if (eventsDropped < 255) eventsDropped++;
+    return;
   }
+  events[eventHead] = event;
+  eventHead = nextHead;
+  #endif
 }
 
 
-void dscKeybusInterface::processPanel_0x34() {
-  if (!validCRC()) return;
-  if (dscZones < 3) return;
-
-  // Open zones 17-24 status is stored in openZones[2] and openZonesChanged[2]: Bit 0 = Zone 17 ... Bit 7 = Zone 24
-  openZones[2] = panelData[6];
-  byte zonesChanged = openZones[2] ^ previousOpenZones[2];
-  if (zonesChanged != 0) {
-    previousOpenZones[2] = openZones[2];
-    openZonesStatusChanged = true;
-    statusChanged = true;
-
-    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-      if (bitRead(zonesChanged, zoneBit)) {
-        bitWrite(openZonesChanged[2], zoneBit, 1);
-        if (bitRead(panelData[6], zoneBit)) bitWrite(openZones[2], zoneBit, 1);
-        else bitWrite(openZones[2], zoneBit, 0);
-      }
-    }
+// Sends an event for each changed zone in zone order, zoneIndex 0 = Zone 1 ... 63 = Zone 64
+void dscKeybusInterface::processZoneEvents(byte type, dscZoneWord zonesChanged, dscZoneWord zones) {
+  while (zonesChanged) {
+    byte zoneIndex = dscNextZone(zonesChanged);
+    processEvent(type, zoneIndex + 1, (zones & dscZoneBit(zoneIndex)) ? 1 : 0);
   }
 }
 
 
-void dscKeybusInterface::processPanel_0x3E() {
-  if (!validCRC()) return;
-  if (dscZones < 4) return;
+// Applies the partition armed messages from 0x27 commands
+void dscKeybusInterface::processPanelArmed(const dscPanelStatus &panelStatus) {
+  for (byte partitionIndex = 0; partitionIndex < panelStatus.partitionCount && partitionIndex < dscPartitions; partitionIndex++) {
+    byte message = panelStatus.messages[partitionIndex];
 
-  // Open zones 25-32 status is stored in openZones[3] and openZonesChanged[3]: Bit 0 = Zone 25 ... Bit 7 = Zone 32
-  openZones[3] = panelData[6];
-  byte zonesChanged = openZones[3] ^ previousOpenZones[3];
-  if (zonesChanged != 0) {
-    previousOpenZones[3] = openZones[3];
-    openZonesStatusChanged = true;
-    statusChanged = true;
+    // Messages
+    if (message == 0x04 || message == 0x05) {
+      if (message == 0x04) {
+        partitions[partitionIndex].armedStay = true;
+        partitions[partitionIndex].armedAway = false;
+      }
+      else if (message == 0x05) {
+        partitions[partitionIndex].armedStay = false;
+        partitions[partitionIndex].armedAway = true;
+      }
 
-    for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-      if (bitRead(zonesChanged, zoneBit)) {
-        bitWrite(openZonesChanged[3], zoneBit, 1);
-        if (bitRead(panelData[6], zoneBit)) bitWrite(openZones[3], zoneBit, 1);
-        else bitWrite(openZones[3], zoneBit, 0);
+      partitions[partitionIndex].exitDelay = false;
+      if (partitions[partitionIndex].exitDelay != partitions[partitionIndex].previousExitDelay) {
+        partitions[partitionIndex].previousExitDelay = partitions[partitionIndex].exitDelay;
+        setPartitionChanged(partitionIndex, dscExitDelayChanged);
+      }
+      partitions[partitionIndex].armed = true;
+      if (partitions[partitionIndex].previousArmed != true) {
+        partitions[partitionIndex].previousArmed = true;
+        setPartitionChanged(partitionIndex, dscArmedChanged);
       }
     }
   }
 }
 
 
-void dscKeybusInterface::processPanel_0xA5() {
-  if (!validCRC()) return;
-
-  byte dscYear3 = panelData[2] >> 4;
-  byte dscYear4 = panelData[2] & 0x0F;
-  year = (dscYear3 * 10) + dscYear4;
-  month = panelData[3] << 2; month >>= 4;
-  byte dscDay1 = panelData[3] << 6; dscDay1 >>= 3;
-  byte dscDay2 = panelData[4] >> 5;
-  day = dscDay1 | dscDay2;
-  hour = panelData[4] & 0x1F;
-  minute = panelData[5] >> 2;
+// Applies the panel time and status messages from 0xA5 and 0xEB commands
+void dscKeybusInterface::processPanelMessage(const dscPanelMessage &message) {
+  year = message.year;
+  month = message.month;
+  day = message.day;
+  hour = message.hour;
+  minute = message.minute;
 
   // Timestamp
-  if (panelData[6] == 0 && panelData[7] == 0) {
+  if (message.timestamp) {
     statusChanged = true;
     timeAvailable = true;
     return;
   }
 
-  byte partition = panelData[3] >> 6;
-  switch (panelData[5] & 0x03) {
-    case 0x00: processPanelStatus0(partition, 6); break;
-    case 0x02: processPanelStatus2(partition, 6); break;
+  switch (message.type) {
+    case 0x00: processPanelStatus0(message); break;
+    case 0x02: processPanelStatus2(message); break;
+    case 0x04: processPanelStatus4(message); break;
   }
 }
 
 
-void dscKeybusInterface::processPanel_0xEB() {
-  if (!validCRC()) return;
-  if (dscPartitions < 3) return;
-
-  byte dscYear3 = panelData[3] >> 4;
-  byte dscYear4 = panelData[3] & 0x0F;
-  year = (dscYear3 * 10) + dscYear4;
-  month = panelData[4] << 2; month >>=4;
-  byte dscDay1 = panelData[4] << 6; dscDay1 >>= 3;
-  byte dscDay2 = panelData[5] >> 5;
-  day = dscDay1 | dscDay2;
-  hour = panelData[5] & 0x1F;
-  minute = panelData[6] >> 2;
-
-  byte partition;
-  switch (panelData[2]) {
-    case 0x01: partition = 1; break;
-    case 0x02: partition = 2; break;
-    case 0x04: partition = 3; break;
-    case 0x08: partition = 4; break;
-    case 0x10: partition = 5; break;
-    case 0x20: partition = 6; break;
-    case 0x40: partition = 7; break;
-    case 0x80: partition = 8; break;
-    default: partition = 0; break;
-  }
-
-  switch (panelData[7] & 0x07) {
-    case 0x00: processPanelStatus0(partition, 8); break;
-    case 0x02: processPanelStatus2(partition, 8); break;
-    case 0x04: processPanelStatus4(partition, 8); break;
-  }
-}
-
-
-
-void dscKeybusInterface::processPanelStatus0(byte partition, byte panelByte) {
+void dscKeybusInterface::processPanelStatus0(const dscPanelMessage &message) {
+  byte partition = message.partition;
 
   // Processes status messages that are not partition-specific
-  if (partition == 0 && panelData[0] == 0xA5) {
-    switch (panelData[panelByte]) {
+  if (partition == 0 && message.command == 0xA5) {
+    switch (message.code) {
       case 0x4E: {       // Keypad Fire alarm
         keypadFireAlarm = true;
         statusChanged = true;
+        processEvent(dscEventKeypadAlarm, 0, 'F');
         return;
       }
       case 0x4F: {       // Keypad Aux alarm
         keypadAuxAlarm = true;
         statusChanged = true;
+        processEvent(dscEventKeypadAlarm, 0, 'A');
         return;
       }
       case 0x50: {       // Keypad Panic alarm
         keypadPanicAlarm = true;
         statusChanged =true;
+        processEvent(dscEventKeypadAlarm, 0, 'P');
         return;
       }
       case 0xE7: {       // Panel battery trouble
         batteryTrouble = true;
         batteryChanged = true;
         statusChanged = true;
+        processEvent(dscEventBatteryTrouble, 0, 1);
         return;
       }
       case 0xE8: {       // Panel AC power failure
         powerTrouble = true;
         powerChanged = true;
         statusChanged = true;
+        processEvent(dscEventPowerTrouble, 0, 1);
         return;
       }
       case 0xEF: {       // Panel battery restored
         batteryTrouble = false;
         batteryChanged = true;
         statusChanged = true;
+        processEvent(dscEventBatteryTrouble, 0, 0);
         return;
       }
       case 0xF0: {       // Panel AC power restored
         powerTrouble = false;
         powerChanged = true;
         statusChanged = true;
+        processEvent(dscEventPowerTrouble, 0, 0);
         return;
       }
       default: return;
@@ -487,198 +352,104 @@ void dscKeybusInterface::processPanelStatus0(byte partition, byte panelByte) {
   }
 
   // Processes partition-specific status
-  if (partition > dscPartitions) return;  // Ensures that only the configured number of partitions are processed
+  if (partition == 0 || partition > dscPartitions) return;  // Ensures that only the configured number of partitions are processed
   byte partitionIndex = partition - 1;
 
-  if (panelData[panelByte] == 0x4A ||                                    // Disarmed after alarm in memory
-      panelData[panelByte] == 0xE6 ||                                    // Disarmed special: keyswitch/wireless key/DLS
-      (panelData[panelByte] >= 0xC0 && panelData[panelByte] <= 0xE4)) {  // Disarmed by access code
+  if (message.code == 0x4A ||                                    // Disarmed after alarm in memory
+      message.code == 0xE6 ||                                    // Disarmed special: keyswitch/wireless key/DLS
+      (message.code >= 0xC0 && message.code <= 0xE4)) {  // Disarmed by access code
 
-    armed[partitionIndex] = false;
-    armedAway[partitionIndex] = false;
-    armedStay[partitionIndex] = false;
-    noEntryDelay[partitionIndex] = false;
-    alarm[partitionIndex] = false;
+    partitions[partitionIndex].armed = false;
+    partitions[partitionIndex].armedAway = false;
+    partitions[partitionIndex].armedStay = false;
+    partitions[partitionIndex].noEntryDelay = false;
+    partitions[partitionIndex].alarm = false;
 
-    if (previousAlarm[partitionIndex] != false) {
-      previousAlarm[partitionIndex] = false;
-      alarmChanged[partitionIndex] = true;
-      statusChanged = true;
+    if (partitions[partitionIndex].previousAlarm != false) {
+      partitions[partitionIndex].previousAlarm = false;
+      setPartitionChanged(partitionIndex, dscAlarmChanged);
     }
 
-    if (previousArmed[partitionIndex] != false) {
-      previousArmed[partitionIndex] = false;
-      armedChanged[partitionIndex] = true;
-      statusChanged = true;
+    if (partitions[partitionIndex].previousArmed != false) {
+      partitions[partitionIndex].previousArmed = false;
+      setPartitionChanged(partitionIndex, dscArmedChanged);
     }
     return;
   }
 
-  if (panelData[panelByte] == 0x4B) {  // Partition in alarm
-    alarm[partitionIndex] = true;
-    if (previousAlarm[partitionIndex] != true) {
-      previousAlarm[partitionIndex] = true;
-      alarmChanged[partitionIndex] = true;
-      statusChanged = true;
+  if (message.code == 0x4B) {  // Partition in alarm
+    partitions[partitionIndex].alarm = true;
+    if (partitions[partitionIndex].previousAlarm != true) {
+      partitions[partitionIndex].previousAlarm = true;
+      setPartitionChanged(partitionIndex, dscAlarmChanged);
     }
     return;
   }
 
   // Zone alarm, zones 1-32
-  // Zone alarm status is stored using 1 bit per zone in alarmZones[] and alarmZonesChanged[]:
-  //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-  //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-  //   ...
-  //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
-  if (panelData[panelByte] >= 0x09 && panelData[panelByte] <= 0x28) {
-    alarm[partitionIndex] = true;
-    if (previousAlarm[partitionIndex] != true) {
-      previousAlarm[partitionIndex] = true;
-      alarmChanged[partitionIndex] = true;
-      statusChanged = true;
+  // Zone alarm status is stored using 1 bit per zone in alarmZones and alarmZonesChanged: Bit 0 = Zone 1 ... Bit 63 = Zone 64
+  if (message.code >= 0x09 && message.code <= 0x28) {
+    partitions[partitionIndex].alarm = true;
+    if (partitions[partitionIndex].previousAlarm != true) {
+      partitions[partitionIndex].previousAlarm = true;
+      setPartitionChanged(partitionIndex, dscAlarmChanged);
     }
 
-    byte maxZones = dscZones * 8;
-    if (maxZones > 32) maxZones = 32;
-    for (byte zoneCount = 0; zoneCount < maxZones; zoneCount++) {
-      if (panelData[panelByte] == 0x09 + zoneCount) {
-        if (zoneCount < 8) {
-          bitWrite(alarmZones[0], zoneCount, 1);
-          if (bitRead(previousAlarmZones[0], zoneCount) != 1) {
-            bitWrite(previousAlarmZones[0], zoneCount, 1);
-            bitWrite(alarmZonesChanged[0], zoneCount, 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 8 && zoneCount < 16) {
-          bitWrite(alarmZones[1], (zoneCount - 8), 1);
-          if (bitRead(previousAlarmZones[1], (zoneCount - 8)) != 1) {
-            bitWrite(previousAlarmZones[1], (zoneCount - 8), 1);
-            bitWrite(alarmZonesChanged[1], (zoneCount - 8), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 16 && zoneCount < 24) {
-          bitWrite(alarmZones[2], (zoneCount - 16), 1);
-          if (bitRead(previousAlarmZones[2], (zoneCount - 16)) != 1) {
-            bitWrite(previousAlarmZones[2], (zoneCount - 16), 1);
-            bitWrite(alarmZonesChanged[2], (zoneCount - 16), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 24 && zoneCount < 32) {
-          bitWrite(alarmZones[3], (zoneCount - 24), 1);
-          if (bitRead(previousAlarmZones[3], (zoneCount - 24)) != 1) {
-            bitWrite(previousAlarmZones[3], (zoneCount - 24), 1);
-            bitWrite(alarmZonesChanged[3], (zoneCount - 24), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-      }
-    }
+    byte zoneIndex = message.code - 0x09;
+    if (zoneIndex < dscZones * 8) processAlarmZone(zoneIndex, 1);
     return;
   }
 
   // Zone alarm restored, zones 1-32
-  // Zone alarm status is stored using 1 bit per zone in alarmZones[] and alarmZonesChanged[]:
-  //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-  //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-  //   ...
-  //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
-  if (panelData[panelByte] >= 0x29 && panelData[panelByte] <= 0x48) {
-
-    byte maxZones = dscZones * 8;
-    if (maxZones > 32) maxZones = 32;
-    for (byte zoneCount = 0; zoneCount < maxZones; zoneCount++) {
-      if (panelData[panelByte] == 0x29 + zoneCount) {
-        if (zoneCount < 8) {
-          bitWrite(alarmZones[0], zoneCount, 0);
-          if (bitRead(previousAlarmZones[0], zoneCount) != 0) {
-            bitWrite(previousAlarmZones[0], zoneCount, 0);
-            bitWrite(alarmZonesChanged[0], zoneCount, 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 8 && zoneCount < 16) {
-          bitWrite(alarmZones[1], (zoneCount - 8), 0);
-          if (bitRead(previousAlarmZones[1], (zoneCount - 8)) != 0) {
-            bitWrite(previousAlarmZones[1], (zoneCount - 8), 0);
-            bitWrite(alarmZonesChanged[1], (zoneCount - 8), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 16 && zoneCount < 24) {
-          bitWrite(alarmZones[2], (zoneCount - 16), 0);
-          if (bitRead(previousAlarmZones[2], (zoneCount - 16)) != 0) {
-            bitWrite(previousAlarmZones[2], (zoneCount - 16), 0);
-            bitWrite(alarmZonesChanged[2], (zoneCount - 16), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-        else if (zoneCount >= 24 && zoneCount < 32) {
-          bitWrite(alarmZones[3], (zoneCount - 24), 0);
-          if (bitRead(previousAlarmZones[3], (zoneCount - 24)) != 0) {
-            bitWrite(previousAlarmZones[3], (zoneCount - 24), 0);
-            bitWrite(alarmZonesChanged[3], (zoneCount - 24), 1);
-            alarmZonesStatusChanged = true;
-            statusChanged = true;
-          }
-        }
-      }
-    }
+  // Zone alarm status is stored using 1 bit per zone in alarmZones and alarmZonesChanged: Bit 0 = Zone 1 ... Bit 63 = Zone 64
+  if (message.code >= 0x29 && message.code <= 0x48) {
+
+    byte zoneIndex = message.code - 0x29;
+    if (zoneIndex < dscZones * 8) processAlarmZone(zoneIndex, 0);
   }
 }
 
 
-void dscKeybusInterface::processPanelStatus2(byte partition, byte panelByte) {
+void dscKeybusInterface::processPanelStatus2(const dscPanelMessage &message) {
+  byte partition = message.partition;
   if (partition == 0 || partition > dscPartitions) return;
   byte partitionIndex = partition - 1;
 
   // Armed: stay and Armed: away
-  if (panelData[panelByte] == 0x9A || panelData[panelByte] == 0x9B) {
-    if (panelData[panelByte] == 0x9A) {
-      armedStay[partitionIndex] = true;
-      armedAway[partitionIndex] = false;
+  if (message.code == 0x9A || message.code == 0x9B) {
+    if (message.code == 0x9A) {
+      partitions[partitionIndex].armedStay = true;
+      partitions[partitionIndex].armedAway = false;
     }
-    else if (panelData[panelByte] == 0x9B) {
-      armedStay[partitionIndex] = false;
-      armedAway[partitionIndex] = true;
+    else if (message.code == 0x9B) {
+      partitions[partitionIndex].armedStay = false;
+      partitions[partitionIndex].armedAway = true;
     }
 
-    armed[partitionIndex] = true;
-    exitDelay[partitionIndex] = false;
-    if (exitDelay[partitionIndex] != previousExitDelay[partitionIndex]) {
-      previousExitDelay[partitionIndex] = exitDelay[partitionIndex];
-      exitDelayChanged[partitionIndex] = true;
-      statusChanged = true;
+    partitions[partitionIndex].armed = true;
+    partitions[partitionIndex].exitDelay = false;
+    if (partitions[partitionIndex].exitDelay != partitions[partitionIndex].previousExitDelay) {
+      partitions[partitionIndex].previousExitDelay = partitions[partitionIndex].exitDelay;
+      setPartitionChanged(partitionIndex, dscExitDelayChanged);
     }
-    if (previousArmed[partitionIndex] != true) {
-      previousArmed[partitionIndex] = true;
-      armedChanged[partitionIndex] = true;
-      statusChanged = true;
+    if (partitions[partitionIndex].previousArmed != true) {
+      partitions[partitionIndex].previousArmed = true;
+      setPartitionChanged(partitionIndex, dscArmedChanged);
     }
     return;
   }
 
-  if (panelData[panelByte] == 0xA5) {
-    switch (panelData[panelByte]) {
+  if (message.code == 0xA5) {
+    switch (message.code) {
       case 0x99: {        // Activate stay/away zones
-        armed[partitionIndex] = true;
-        armedAway[partitionIndex] = true;
-        armedStay[partitionIndex] = false;
-        armedChanged[partitionIndex] = true;
-        statusChanged = true;
+        partitions[partitionIndex].armed = true;
+        partitions[partitionIndex].armedAway = true;
+        partitions[partitionIndex].armedStay = false;
+        setPartitionChanged(partitionIndex, dscArmedChanged);
         return;
       }
       case 0x9C: {        // Armed without entry delay
-        noEntryDelay[partitionIndex] = true;
+        partitions[partitionIndex].noEntryDelay = true;
         return;
       }
     }
@@ -686,193 +457,77 @@ void dscKeybusInterface::processPanelStatus2(byte partition, byte panelByte) {
 }
 
 
-void dscKeybusInterface::processPanelStatus4(byte partition, byte panelByte) {
+void dscKeybusInterface::processPanelStatus4(const dscPanelMessage &message) {
+  byte partition = message.partition;
   if (partition == 0 || partition > dscPartitions) return;
   byte partitionIndex = partition - 1;
 
   // Zone alarm, zones 33-64
-  // Zone alarm status is stored using 1 bit per zone in alarmZones[] and alarmZonesChanged[]:
-  //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-  //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-  //   ...
-  //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
-  if (panelData[panelByte] <= 0x1F) {
+  // Zone alarm status is stored using 1 bit per zone in alarmZones and alarmZonesChanged: Bit 0 = Zone 1 ... Bit 63 = Zone 64
+  if (message.code <= 0x1F) {
     alarmZonesStatusChanged = true;
-    alarm[partitionIndex] = true;
-    if (previousAlarm[partitionIndex] != true) {
-      previousAlarm[partitionIndex] = true;
-      alarmChanged[partitionIndex] = true;
-      statusChanged = true;
+    partitions[partitionIndex].alarm = true;
+    if (partitions[partitionIndex].previousAlarm != true) {
+      partitions[partitionIndex].previousAlarm = true;
+      setPartitionChanged(partitionIndex, dscAlarmChanged);
     }
 
-    byte maxZones = dscZones * 8;
-    if (maxZones > 32) maxZones -= 32;
-    else return;
-    for (byte zoneCount = 0; zoneCount < maxZones; zoneCount++) {
-      if (panelData[panelByte] == zoneCount) {
-        if (zoneCount < 8) {
-          bitWrite(alarmZones[4], zoneCount, 1);
-          bitWrite(alarmZonesChanged[4], zoneCount, 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 8 && zoneCount < 16) {
-          bitWrite(alarmZones[5], (zoneCount - 8), 1);
-          bitWrite(alarmZonesChanged[5], (zoneCount - 8), 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 16 && zoneCount < 24) {
-          bitWrite(alarmZones[6], (zoneCount - 16), 1);
-          bitWrite(alarmZonesChanged[6], (zoneCount - 16), 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 24 && zoneCount < 32) {
-          bitWrite(alarmZones[7], (zoneCount - 24), 1);
-          bitWrite(alarmZonesChanged[7], (zoneCount - 24), 1);
-          statusChanged = true;
-        }
-      }
+    byte zoneIndex = message.code + 32;
+    if (zoneIndex < dscZones * 8) {
+      alarmZones |= dscZoneBit(zoneIndex);
+      alarmZonesChanged |= dscZoneBit(zoneIndex);
+      statusChanged = true;
+      processEvent(dscEventZoneAlarm, zoneIndex + 1, 1);
     }
     return;
   }
 
   // Zone alarm restored, zones 33-64
-  // Zone alarm status is stored using 1 bit per zone in alarmZones[] and alarmZonesChanged[]:
-  //   alarmZones[0] and alarmZonesChanged[0]: Bit 0 = Zone 1 ... Bit 7 = Zone 8
-  //   alarmZones[1] and alarmZonesChanged[1]: Bit 0 = Zone 9 ... Bit 7 = Zone 16
-  //   ...
-  //   alarmZones[7] and alarmZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
-  if (panelData[panelByte] >= 0x20 && panelData[panelByte] <= 0x3F) {
+  // Zone alarm status is stored using 1 bit per zone in alarmZones and alarmZonesChanged: Bit 0 = Zone 1 ... Bit 63 = Zone 64
+  if (message.code >= 0x20 && message.code <= 0x3F) {
     alarmZonesStatusChanged = true;
 
-    byte maxZones = dscZones * 8;
-    if (maxZones > 32) maxZones -= 32;
-    else return;
-    for (byte zoneCount = 0; zoneCount < maxZones; zoneCount++) {
-      if (panelData[panelByte] == 0x20 + zoneCount) {
-        if (zoneCount < 8) {
-          bitWrite(alarmZones[4], zoneCount, 0);
-          bitWrite(alarmZonesChanged[4], zoneCount, 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 8 && zoneCount < 16) {
-          bitWrite(alarmZones[5], (zoneCount - 8), 0);
-          bitWrite(alarmZonesChanged[5], (zoneCount - 8), 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 16 && zoneCount < 24) {
-          bitWrite(alarmZones[6], (zoneCount - 16), 0);
-          bitWrite(alarmZonesChanged[6], (zoneCount - 16), 1);
-          statusChanged = true;
-        }
-        else if (zoneCount >= 24 && zoneCount < 32) {
-          bitWrite(alarmZones[7], (zoneCount - 24), 0);
-          bitWrite(alarmZonesChanged[7], (zoneCount - 24), 1);
-          statusChanged = true;
-        }
-      }
-    }
-    return;
-  }
-
-}
-
-
-// Processes zones 33-64 status
-void dscKeybusInterface::processPanel_0xE6() {
-  if (!validCRC()) return;
-
-  switch (panelData[2]) {
-    case 0x09: processPanel_0xE6_0x09(); return;
-    case 0x0B: processPanel_0xE6_0x0B(); return;
-    case 0x0D: processPanel_0xE6_0x0D(); return;
-    case 0x0F: processPanel_0xE6_0x0F(); return;
-  }
-}
-
-
-// Open zones 33-40 status is stored in openZones[4] and openZonesChanged[4]: Bit 0 = Zone 33 ... Bit 7 = Zone 40
-void dscKeybusInterface::processPanel_0xE6_0x09() {
-  if (dscZones > 4) {
-    openZones[4] = panelData[3];
-    byte zonesChanged = openZones[4] ^ previousOpenZones[4];
-    if (zonesChanged != 0) {
-      previousOpenZones[4] = openZones[4];
-      openZonesStatusChanged = true;
+    byte zoneIndex = message.code - 0x20 + 32;
+    if (zoneIndex < dscZones * 8) {
+      alarmZones &= ~dscZoneBit(zoneIndex);
+      alarmZonesChanged |= dscZoneBit(zoneIndex);
       statusChanged = true;
-
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(openZonesChanged[4], zoneBit, 1);
-          if (bitRead(panelData[3], zoneBit)) bitWrite(openZones[4], zoneBit, 1);
-          else bitWrite(openZones[4], zoneBit, 0);
-        }
-      }
+      processEvent(dscEventZoneAlarm, zoneIndex + 1, 0);
     }
+    return;
   }
-}
-
 
-// Open zones 41-48 status is stored in openZones[5] and openZonesChanged[5]: Bit 0 = Zone 41 ... Bit 7 = Zone 48
-void dscKeybusInterface::processPanel_0xE6_0x0B() {
-  if (dscZones > 5) {
-    openZones[5] = panelData[3];
-    byte zonesChanged = openZones[5] ^ previousOpenZones[5];
-    if (zonesChanged != 0) {
-      previousOpenZones[5] = openZones[5];
-      openZonesStatusChanged = true;
-      statusChanged = true;
-
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(openZonesChanged[5], zoneBit, 1);
-          if (bitRead(panelData[3], zoneBit)) bitWrite(openZones[5], zoneBit, 1);
-          else bitWrite(openZones[5], zoneBit, 0);
-        }
-      }
-    }
-  }
 }
 
 
-// Open zones 49-56 status is stored in openZones[6] and openZonesChanged[6]: Bit 0 = Zone 49 ... Bit 7 = Zone 56
-void dscKeybusInterface::processPanel_0xE6_0x0D() {
-  if (dscZones > 6) {
-    openZones[6] = panelData[3];
-    byte zonesChanged = openZones[6] ^ previousOpenZones[6];
-    if (zonesChanged != 0) {
-      previousOpenZones[6] = openZones[6];
-      openZonesStatusChanged = true;
-      statusChanged = true;
-
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(openZonesChanged[6], zoneBit, 1);
-          if (bitRead(panelData[3], zoneBit)) bitWrite(openZones[6], zoneBit, 1);
-          else bitWrite(openZones[6], zoneBit, 0);
-        }
-      }
-    }
+// Sets the alarm status of a zone, zoneIndex 0 = Zone 1 ... 63 = Zone 64
+void dscKeybusInterface::processAlarmZone(byte zoneIndex, byte zoneAlarm) {
+  dscZoneWord zoneBit = dscZoneBit(zoneIndex);
+  if (zoneAlarm) alarmZones |= zoneBit;
+  else alarmZones &= ~zoneBit;
+  if ((alarmZones ^ previousAlarmZones) & zoneBit) {
+    previousAlarmZones ^= zoneBit;
+    alarmZonesChanged |= zoneBit;
+    alarmZonesStatusChanged = true;
+    statusChanged = true;
+    processEvent(dscEventZoneAlarm, zoneIndex + 1, zoneAlarm);
   }
 }
 
 
-// Open zones 57-64 status is stored in openZones[7] and openZonesChanged[7]: Bit 0 = Zone 57 ... Bit 7 = Zone 64
-void dscKeybusInterface::processPanel_0xE6_0x0F() {
-  if (dscZones > 7) {
-    openZones[7] = panelData[3];
-    byte zonesChanged = openZones[7] ^ previousOpenZones[7];
-    if (zonesChanged != 0) {
-      previousOpenZones[7] = openZones[7];
-      openZonesStatusChanged = true;
-      statusChanged = true;
-
-      for (byte zoneBit = 0; zoneBit < 8; zoneBit++) {
-        if (bitRead(zonesChanged, zoneBit)) {
-          bitWrite(openZonesChanged[7], zoneBit, 1);
-          if (bitRead(panelData[3], zoneBit)) bitWrite(openZones[7], zoneBit, 1);
-          else bitWrite(openZones[7], zoneBit, 0);
-        }
-      }
-    }
+// Sets the open status of a group of 8 zones, zoneGroup 0 = Zones 1-8 ... 7 = Zones 57-64.  Changes are found for
+// the whole group at once by comparing against the previous status.
+void dscKeybusInterface::processOpenZones(byte zoneGroup, byte zoneStatus) {
+  if (zoneGroup >= dscZones) return;  // Ensures that only the configured number of zones are processed
+  byte zoneShift = zoneGroup * 8;
+  dscZoneWord groupMask = (dscZoneWord)0xFF << zoneShift;
+  openZones = (openZones & ~groupMask) | ((dscZoneWord)zoneStatus << zoneShift);
+  dscZoneWord zonesChanged = (openZones ^ previousOpenZones) & groupMask;
+  if (zonesChanged != 0) {
+    previousOpenZones ^= zonesChanged;
+    openZonesChanged |= zonesChanged;
+    openZonesStatusChanged = true;
+    statusChanged = true;
+    processZoneEvents(dscEventZoneOpen, zonesChanged, openZones);
   }
 }